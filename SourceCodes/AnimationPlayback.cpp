@@ -0,0 +1,282 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AnimationPlayback.cpp
+///
+/// @brief Packed animation playback storage and the frame advance kernel.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "AnimationPlayback.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UE_ANIMATION_PLAYBACK_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Framework {
+
+	std::vector<float> AnimationPlayback::times{};
+	std::vector<float> AnimationPlayback::speeds{};
+	std::vector<float> AnimationPlayback::frameCounts{};
+	std::vector<float> AnimationPlayback::periods{};
+	std::vector<std::uint32_t> AnimationPlayback::onceMasks{};
+	std::vector<std::uint32_t> AnimationPlayback::finishedMasks{};
+	std::vector<std::int32_t> AnimationPlayback::startFrames{};
+	std::vector<std::int32_t> AnimationPlayback::frames{};
+	std::vector<std::uint8_t> AnimationPlayback::touched{};
+	std::vector<Entity> AnimationPlayback::entities{};
+	std::vector<std::int32_t> AnimationPlayback::slotOfEntity{};
+	std::vector<AnimationPlaybackEvent> AnimationPlayback::events{};
+
+	std::size_t AnimationPlayback::SlotFor(Entity entity)
+	{
+		if (entity >= slotOfEntity.size())
+		{
+			slotOfEntity.resize(static_cast<std::size_t>(entity) + 1, -1);
+		}
+		if (slotOfEntity[entity] >= 0)
+		{
+			return static_cast<std::size_t>(slotOfEntity[entity]);
+		}
+
+		std::size_t slot = entities.size();
+		slotOfEntity[entity] = static_cast<std::int32_t>(slot);
+		entities.push_back(entity);
+		times.push_back(0.0f);
+		speeds.push_back(0.0f);
+		frameCounts.push_back(1.0f);
+		periods.push_back(0.0f);
+		onceMasks.push_back(0u);
+		finishedMasks.push_back(0u);
+		startFrames.push_back(0);
+		frames.push_back(-1);
+		touched.push_back(1);
+		return slot;
+	}
+
+	void AnimationPlayback::Play(Entity entity, int frameCount, float speed, AnimationLoopMode mode, int startFrame)
+	{
+		std::size_t slot = SlotFor(entity);
+		float count = static_cast<float>(std::max(frameCount, 1));
+		speed = std::max(speed, 0.0f);
+
+		times[slot] = 0.0f;
+		speeds[slot] = speed;
+		frameCounts[slot] = count;
+		periods[slot] = (speed > 0.0f) ? count / speed : 0.0f;
+		onceMasks[slot] = (mode == AnimationLoopMode::Once) ? ~0u : 0u;
+		finishedMasks[slot] = 0u;
+		startFrames[slot] = startFrame;
+		frames[slot] = -1;
+		touched[slot] = 1;
+	}
+
+	void AnimationPlayback::Sync(Entity entity, int frameCount, float speed, AnimationLoopMode mode, int startFrame)
+	{
+		std::int32_t existing = (entity < slotOfEntity.size()) ? slotOfEntity[entity] : -1;
+		if (existing < 0)
+		{
+			Play(entity, frameCount, speed, mode, startFrame);
+			return;
+		}
+
+		std::size_t slot = static_cast<std::size_t>(existing);
+		float count = static_cast<float>(std::max(frameCount, 1));
+		std::uint32_t onceMask = (mode == AnimationLoopMode::Once) ? ~0u : 0u;
+		if (frameCounts[slot] != count || startFrames[slot] != startFrame || onceMasks[slot] != onceMask)
+		{
+			Play(entity, frameCount, speed, mode, startFrame);
+			return;
+		}
+
+		speed = std::max(speed, 0.0f);
+		if (speeds[slot] != speed)
+		{
+			speeds[slot] = speed;
+			periods[slot] = (speed > 0.0f) ? count / speed : 0.0f;
+		}
+		touched[slot] = 1;
+	}
+
+	void AnimationPlayback::RemoveSlot(std::size_t slot)
+	{
+		// Swap with the last slot so the arrays stay packed
+		std::size_t last = entities.size() - 1;
+		slotOfEntity[entities[slot]] = -1;
+		if (slot != last)
+		{
+			times[slot] = times[last];
+			speeds[slot] = speeds[last];
+			frameCounts[slot] = frameCounts[last];
+			periods[slot] = periods[last];
+			onceMasks[slot] = onceMasks[last];
+			finishedMasks[slot] = finishedMasks[last];
+			startFrames[slot] = startFrames[last];
+			frames[slot] = frames[last];
+			touched[slot] = touched[last];
+			entities[slot] = entities[last];
+			slotOfEntity[entities[slot]] = static_cast<std::int32_t>(slot);
+		}
+		times.pop_back();
+		speeds.pop_back();
+		frameCounts.pop_back();
+		periods.pop_back();
+		onceMasks.pop_back();
+		finishedMasks.pop_back();
+		startFrames.pop_back();
+		frames.pop_back();
+		touched.pop_back();
+		entities.pop_back();
+	}
+
+	void AnimationPlayback::Remove(Entity entity)
+	{
+		if (entity < slotOfEntity.size() && slotOfEntity[entity] >= 0)
+		{
+			RemoveSlot(static_cast<std::size_t>(slotOfEntity[entity]));
+		}
+	}
+
+	void AnimationPlayback::Sweep()
+	{
+		// Backwards, a removal moves the last slot into the one being looked at
+		for (std::size_t slot = entities.size(); slot-- > 0;)
+		{
+			if (!touched[slot])
+			{
+				RemoveSlot(slot);
+			}
+		}
+		std::fill(touched.begin(), touched.end(), std::uint8_t{ 0 });
+	}
+
+	void AnimationPlayback::Advance(float deltaTime)
+	{
+		events.clear();
+
+		const std::size_t count = entities.size();
+		std::size_t slot = 0;
+
+#ifdef UE_ANIMATION_PLAYBACK_SSE2
+		const __m128 dt = _mm_set1_ps(deltaTime);
+		const __m128 one = _mm_set1_ps(1.0f);
+		for (; slot + 4 <= count; slot += 4)
+		{
+			__m128 done = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(finishedMasks.data() + slot)));
+			__m128 once = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(onceMasks.data() + slot)));
+			__m128 frameCount = _mm_loadu_ps(frameCounts.data() + slot);
+
+			// A finished play-once animation holds its time, and so its last frame
+			__m128 time = _mm_add_ps(_mm_loadu_ps(times.data() + slot), _mm_andnot_ps(done, dt));
+
+			// Times and speeds are never negative, truncation is floor
+			__m128 frame = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(time, _mm_loadu_ps(speeds.data() + slot))));
+			__m128 cycles = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(frame, frameCount)));
+			__m128 wrapped = _mm_sub_ps(frame, _mm_mul_ps(cycles, frameCount));
+			__m128 lastFrame = _mm_sub_ps(frameCount, one);
+			__m128 held = _mm_min_ps(frame, lastFrame);
+			__m128 local = _mm_or_ps(_mm_and_ps(once, held), _mm_andnot_ps(once, wrapped));
+
+			// Looping time is kept within one cycle so it never loses precision
+			time = _mm_sub_ps(time, _mm_andnot_ps(once, _mm_mul_ps(cycles, _mm_loadu_ps(periods.data() + slot))));
+			__m128 reachedEnd = _mm_and_ps(once, _mm_cmpge_ps(frame, lastFrame));
+
+			__m128i newFrame = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(startFrames.data() + slot)), _mm_cvttps_epi32(local));
+			__m128i oldFrame = _mm_loadu_si128(reinterpret_cast<const __m128i*>(frames.data() + slot));
+
+			int changedBits = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(newFrame, oldFrame))) & 0xF;
+			int finishedBits = _mm_movemask_ps(_mm_andnot_ps(done, reachedEnd));
+
+			_mm_storeu_ps(times.data() + slot, time);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(frames.data() + slot), newFrame);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(finishedMasks.data() + slot), _mm_castps_si128(_mm_or_ps(done, reachedEnd)));
+
+			// Most animations hold a frame for several updates, so most groups have nothing to report
+			if ((changedBits | finishedBits) != 0)
+			{
+				for (int lane = 0; lane < 4; ++lane)
+				{
+					std::uint8_t flags = static_cast<std::uint8_t>(((changedBits >> lane) & 1) * AnimationFrameChanged
+						| ((finishedBits >> lane) & 1) * AnimationFinished);
+					if (flags != 0)
+					{
+						events.push_back({ entities[slot + lane], frames[slot + lane], flags });
+					}
+				}
+			}
+		}
+#endif
+
+		// Same math one slot at a time, for the remainder or without SSE2
+		for (; slot < count; ++slot)
+		{
+			bool done = finishedMasks[slot] != 0;
+			bool once = onceMasks[slot] != 0;
+			float frameCount = frameCounts[slot];
+
+			float time = times[slot] + (done ? 0.0f : deltaTime);
+			float frame = static_cast<float>(static_cast<std::int32_t>(time * speeds[slot]));
+			float cycles = static_cast<float>(static_cast<std::int32_t>(frame / frameCount));
+			float local = once ? std::min(frame, frameCount - 1.0f) : frame - cycles * frameCount;
+			if (!once)
+			{
+				time -= cycles * periods[slot];
+			}
+			bool reachedEnd = once && frame >= frameCount - 1.0f;
+
+			std::int32_t newFrame = startFrames[slot] + static_cast<std::int32_t>(local);
+			std::uint8_t flags = static_cast<std::uint8_t>((newFrame != frames[slot] ? AnimationFrameChanged : 0)
+				| (reachedEnd && !done ? AnimationFinished : 0));
+
+			times[slot] = time;
+			frames[slot] = newFrame;
+			finishedMasks[slot] = (done || reachedEnd) ? ~0u : 0u;
+			if (flags != 0)
+			{
+				events.push_back({ entities[slot], newFrame, flags });
+			}
+		}
+	}
+
+	bool AnimationPlayback::Has(Entity entity)
+	{
+		return entity < slotOfEntity.size() && slotOfEntity[entity] >= 0;
+	}
+
+	int AnimationPlayback::Frame(Entity entity)
+	{
+		if (!Has(entity))
+		{
+			return -1;
+		}
+		std::size_t slot = static_cast<std::size_t>(slotOfEntity[entity]);
+		return (frames[slot] < 0) ? startFrames[slot] : frames[slot];
+	}
+
+	int AnimationPlayback::DrawnFrame(Entity entity, int frameCount)
+	{
+		int frame = Frame(entity);
+		return (frame < 0 || frame >= frameCount) ? 0 : frame;
+	}
+
+	void AnimationPlayback::Clear()
+	{
+		times.clear();
+		speeds.clear();
+		frameCounts.clear();
+		periods.clear();
+		onceMasks.clear();
+		finishedMasks.clear();
+		startFrames.clear();
+		frames.clear();
+		touched.clear();
+		entities.clear();
+		slotOfEntity.clear();
+		events.clear();
+	}
+}
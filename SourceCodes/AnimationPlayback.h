@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AnimationPlayback.h
+///
+/// @brief Playback state of every animated sprite, stored as parallel arrays
+///        (time, speed, frame count, start frame, loop mode, frame) so one
+///        kernel advances all of them per update, four at a time with SSE2.
+///        The kernel reports frames that changed and play-once animations
+///        that finished; the AnimationSystem reacts to those events and the
+///        renderer only reads the resulting frame index.
+///
+///        Slots are packed, an entity's slot moves when another entity is
+///        removed, so slots are never kept across updates; look entities up
+///        with Frame / Has instead.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _ANIMATION_PLAYBACK_H_
+#define _ANIMATION_PLAYBACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ComponentList.h"
+
+namespace Framework {
+
+	enum class AnimationLoopMode : std::uint8_t
+	{
+		Loop,   // Wraps back to the start frame
+		Once    // Holds the last frame and reports Finished
+	};
+
+	enum AnimationPlaybackEventFlags : std::uint8_t
+	{
+		AnimationFrameChanged = 1u << 0,
+		AnimationFinished = 1u << 1
+	};
+
+	struct AnimationPlaybackEvent
+	{
+		Entity entity;
+		std::int32_t frame;             // Frame after the advance
+		std::uint8_t flags;             // AnimationPlaybackEventFlags
+	};
+
+	class AnimationPlayback
+	{
+	public:
+		/**
+		 * @brief (Re)starts an entity's animation from its first frame, adding the entity if needed.
+		 *
+		 * @param frameCount : frames in the sheet (rows * cols), 0 holds startFrame
+		 * @param speed : frames per second
+		 */
+		static void Play(Entity entity, int frameCount, float speed, AnimationLoopMode mode, int startFrame = 0);
+
+		/**
+		 * @brief Plays the given parameters, restarting only when the frame count, start frame or mode
+		 *        differ from what the entity is playing; a new speed carries on from the current time.
+		 */
+		static void Sync(Entity entity, int frameCount, float speed, AnimationLoopMode mode, int startFrame = 0);
+
+		static void Remove(Entity entity);
+
+		/**
+		 * @brief Removes every entity not passed to Play or Sync since the last Sweep, e.g. destroyed ones.
+		 */
+		static void Sweep();
+
+		/**
+		 * @brief Advances every animation by deltaTime and replaces the event list.
+		 */
+		static void Advance(float deltaTime);
+
+		// Events of the last Advance, in slot order
+		static const std::vector<AnimationPlaybackEvent>& GetEvents() { return events; }
+
+		static bool Has(Entity entity);
+
+		// Frame to draw, -1 if the entity has no playback
+		static int Frame(Entity entity);
+
+		// Frame to draw on a sheet of frameCount cells, 0 when not advanced yet or the sheet changed while paused.
+		// The renderer and the picking pass both use it, so a sprite is picked by the frame it shows
+		static int DrawnFrame(Entity entity, int frameCount);
+
+		static std::size_t GetCount() { return entities.size(); }
+
+		static void Clear();
+
+	private:
+		static std::size_t SlotFor(Entity entity);
+		static void RemoveSlot(std::size_t slot);
+
+		// Parallel arrays, one element per playing entity
+		static std::vector<float> times;
+		static std::vector<float> speeds;
+		static std::vector<float> frameCounts;          // At least 1, as float since the kernel divides by it
+		static std::vector<float> periods;              // frameCount / speed, 0 for a stopped animation
+		static std::vector<std::uint32_t> onceMasks;    // ~0u for AnimationLoopMode::Once, lane masks for the kernel
+		static std::vector<std::uint32_t> finishedMasks; // ~0u once a play-once animation reached its last frame
+		static std::vector<std::int32_t> startFrames;
+		static std::vector<std::int32_t> frames;        // -1 after Play, so the first advance reports the frame
+		static std::vector<std::uint8_t> touched;      // Played or synced since the last Sweep
+		static std::vector<Entity> entities;
+
+		// Indexed by entity, -1 when it has no slot
+		static std::vector<std::int32_t> slotOfEntity;
+
+		static std::vector<AnimationPlaybackEvent> events;
+	};
+}
+#endif // !_ANIMATION_PLAYBACK_H_
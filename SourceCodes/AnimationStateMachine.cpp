@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AnimationStateMachine.cpp
+///
+/// @brief Loading, compiling and stepping animation state machines.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "AnimationStateMachine.h"
+#include <iostream>
+#include "rapidjson/document.h"
+#include "AssetArchive.h"
+#include "AssetManager.h"
+
+namespace Framework {
+
+	std::vector<AnimationStateMachine> AnimationStateMachines::machines{};
+	std::unordered_map<std::string, std::pair<std::int16_t, std::int16_t>> AnimationStateMachines::sheetOwners{};
+	std::vector<AnimationStateInstance> AnimationStateMachines::instances{};
+
+	struct AnimationTriggerName
+	{
+		const char* name;
+		std::uint32_t trigger;
+	};
+
+	static const AnimationTriggerName triggerNames[] = {
+		{ "collided", AnimationTriggerCollided },
+		{ "health==0", AnimationTriggerHealthZero },
+		{ "health>0", AnimationTriggerHealthAboveZero }
+	};
+
+	std::uint32_t AnimationStateMachines::TriggerFromName(const std::string& name)
+	{
+		for (const AnimationTriggerName& entry : triggerNames)
+		{
+			if (name == entry.name)
+			{
+				return entry.trigger;
+			}
+		}
+		return 0;
+	}
+
+	static std::int16_t FindState(const AnimationStateMachine& machine, const std::string& name)
+	{
+		for (std::size_t i = 0; i < machine.states.size(); ++i)
+		{
+			if (machine.states[i].name == name)
+			{
+				return static_cast<std::int16_t>(i);
+			}
+		}
+		return -1;
+	}
+
+	// Declared transition before it is grouped by source state, -1 source for "*"
+	struct DeclaredTransition
+	{
+		std::int16_t from;
+		AnimationTransition transition;
+	};
+
+	// Designers edit the file by hand, a value of the wrong type is skipped rather than asserted on
+	static bool IsStringMember(const rapidjson::Value& json, const char* name)
+	{
+		return json.IsObject() && json.HasMember(name) && json[name].IsString();
+	}
+
+	static bool CompileMachine(const rapidjson::Value& json, AnimationStateMachine& machine)
+	{
+		if (!IsStringMember(json, "name") || !json.HasMember("states") || !json["states"].IsArray())
+		{
+			std::cout << "AnimationAsset: state machine without name or states skipped" << std::endl;
+			return false;
+		}
+		machine.name = json["name"].GetString();
+
+		auto& animations = GlobalAssetManager.GetAnimationDataMap();
+		for (const rapidjson::Value& stateJson : json["states"].GetArray())
+		{
+			if (!IsStringMember(stateJson, "name") || !IsStringMember(stateJson, "sheet"))
+			{
+				std::cout << "AnimationAsset: " << machine.name << " has a state without a name or sheet string, skipped" << std::endl;
+				continue;
+			}
+			if (stateJson.HasMember("playOnce") && !stateJson["playOnce"].IsBool())
+			{
+				std::cout << "AnimationAsset: " << machine.name << "." << stateJson["name"].GetString() << " playOnce is not true or false, skipped" << std::endl;
+				continue;
+			}
+			AnimationState state;
+			state.name = stateJson["name"].GetString();
+			state.sheet = stateJson["sheet"].GetString();
+			state.playOnce = stateJson.HasMember("playOnce") && stateJson["playOnce"].GetBool();
+
+			auto animation = animations.find(state.sheet);
+			if (animation != animations.end())
+			{
+				state.rows = animation->second.rows;
+				state.cols = animation->second.cols;
+				state.animationSpeed = animation->second.animationSpeed;
+			}
+			else
+			{
+				std::cout << "AnimationAsset: " << machine.name << "." << state.name << " uses sheet " << state.sheet << " with no animation data" << std::endl;
+			}
+			machine.states.push_back(state);
+		}
+
+		// Names resolve once every state is known
+		for (const rapidjson::Value& stateJson : json["states"].GetArray())
+		{
+			if (!IsStringMember(stateJson, "name") || !IsStringMember(stateJson, "sheet") || !stateJson.HasMember("next"))
+			{
+				continue;
+			}
+			if (!stateJson["next"].IsString() || FindState(machine, stateJson["name"].GetString()) < 0)
+			{
+				std::cout << "AnimationAsset: " << machine.name << "." << stateJson["name"].GetString() << " has a next that is not a state name" << std::endl;
+				continue;
+			}
+			AnimationState& state = machine.states[FindState(machine, stateJson["name"].GetString())];
+			state.next = FindState(machine, stateJson["next"].GetString());
+			if (state.next < 0)
+			{
+				std::cout << "AnimationAsset: " << machine.name << "." << state.name << " has unknown next state" << std::endl;
+			}
+		}
+
+		std::vector<DeclaredTransition> declared;
+		if (json.HasMember("transitions") && json["transitions"].IsArray())
+		{
+			for (const rapidjson::Value& transitionJson : json["transitions"].GetArray())
+			{
+				if (!IsStringMember(transitionJson, "to") || !transitionJson.HasMember("when") || !transitionJson["when"].IsArray() ||
+					(transitionJson.HasMember("from") && !transitionJson["from"].IsString()))
+				{
+					std::cout << "AnimationAsset: " << machine.name << " has a transition without to/from strings or a when list, skipped" << std::endl;
+					continue;
+				}
+
+				DeclaredTransition entry{};
+				std::string from = transitionJson.HasMember("from") ? transitionJson["from"].GetString() : "*";
+				entry.from = (from == "*") ? -1 : FindState(machine, from);
+				entry.transition.target = FindState(machine, transitionJson["to"].GetString());
+
+				bool valid = entry.transition.target >= 0 && (from == "*" || entry.from >= 0);
+				for (const rapidjson::Value& trigger : transitionJson["when"].GetArray())
+				{
+					std::uint32_t bit = trigger.IsString() ? AnimationStateMachines::TriggerFromName(trigger.GetString()) : 0;
+					valid = valid && bit != 0;
+					entry.transition.triggers |= bit;
+				}
+
+				if (!valid || entry.transition.triggers == 0)
+				{
+					std::cout << "AnimationAsset: " << machine.name << " has a transition with an unknown state or trigger, skipped" << std::endl;
+					continue;
+				}
+				declared.push_back(entry);
+			}
+		}
+
+		// Each state gets its own contiguous run, "*" transitions included in declaration order
+		for (std::size_t stateIndex = 0; stateIndex < machine.states.size(); ++stateIndex)
+		{
+			AnimationState& state = machine.states[stateIndex];
+			state.firstTransition = static_cast<std::uint16_t>(machine.transitions.size());
+			for (const DeclaredTransition& entry : declared)
+			{
+				if (entry.from < 0 || entry.from == static_cast<std::int16_t>(stateIndex))
+				{
+					machine.transitions.push_back(entry.transition);
+				}
+			}
+			state.transitionCount = static_cast<std::uint16_t>(machine.transitions.size() - state.firstTransition);
+		}
+		return !machine.states.empty();
+	}
+
+	bool AnimationStateMachines::Load(const std::string& path)
+	{
+		Clear();
+
+		AssetData file;
+		if (!AssetArchive::Open(path, file))
+		{
+			std::cout << "Cannot open " << path << " for animation state machines" << std::endl;
+			return false;
+		}
+
+		rapidjson::Document document;
+		document.Parse(reinterpret_cast<const char*>(file.Data()), file.Size());
+		if (document.HasParseError() || !document.IsObject())
+		{
+			std::cout << path << " is not valid JSON" << std::endl;
+			return false;
+		}
+		if (!document.HasMember("stateMachines") || !document["stateMachines"].IsArray())
+		{
+			return true;
+		}
+
+		for (const rapidjson::Value& machineJson : document["stateMachines"].GetArray())
+		{
+			AnimationStateMachine machine;
+			if (CompileMachine(machineJson, machine))
+			{
+				machines.push_back(std::move(machine));
+			}
+		}
+
+		for (std::size_t machineIndex = 0; machineIndex < machines.size(); ++machineIndex)
+		{
+			const std::vector<AnimationState>& states = machines[machineIndex].states;
+			for (std::size_t stateIndex = 0; stateIndex < states.size(); ++stateIndex)
+			{
+				sheetOwners.emplace(states[stateIndex].sheet,
+					std::make_pair(static_cast<std::int16_t>(machineIndex), static_cast<std::int16_t>(stateIndex)));
+			}
+		}
+
+		std::cout << "Compiled " << machines.size() << " animation state machines" << std::endl;
+		return true;
+	}
+
+	void AnimationStateMachines::Clear()
+	{
+		machines.clear();
+		sheetOwners.clear();
+		instances.clear();
+	}
+
+	AnimationStateInstance* AnimationStateMachines::Sync(Entity entity, const std::string& sheet)
+	{
+		if (entity >= instances.size())
+		{
+			instances.resize(static_cast<std::size_t>(entity) + 1);
+		}
+		AnimationStateInstance& instance = instances[entity];
+
+		// Common case, the sheet is still the one of the current state
+		if (instance.machine >= 0 && machines[instance.machine].states[instance.state].sheet == sheet)
+		{
+			return &instance;
+		}
+
+		auto owner = sheetOwners.find(sheet);
+		if (owner == sheetOwners.end())
+		{
+			instance = AnimationStateInstance{};
+			return nullptr;
+		}
+
+		// Shown from outside (scene load, editor), enter the first state using the sheet
+		instance.machine = owner->second.first;
+		instance.state = owner->second.second;
+		return &instance;
+	}
+
+	bool AnimationStateMachines::ApplyTriggers(AnimationStateInstance& instance, std::uint32_t triggers)
+	{
+		const AnimationStateMachine& machine = machines[instance.machine];
+		const AnimationState& state = machine.states[instance.state];
+
+		const AnimationTransition* transition = machine.transitions.data() + state.firstTransition;
+		const AnimationTransition* end = transition + state.transitionCount;
+		for (; transition != end; ++transition)
+		{
+			if ((triggers & transition->triggers) == transition->triggers)
+			{
+				if (transition->target == instance.state)
+				{
+					return false;
+				}
+				instance.state = transition->target;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool AnimationStateMachines::Complete(AnimationStateInstance& instance)
+	{
+		const AnimationState& state = GetState(instance);
+		if (!state.playOnce || state.next < 0)
+		{
+			return false;
+		}
+		instance.state = state.next;
+		return true;
+	}
+
+	bool AnimationStateMachines::CollectMachineSheets(const std::string& sheet, std::unordered_set<std::string>& sheets)
+	{
+		auto owner = sheetOwners.find(sheet);
+		if (owner == sheetOwners.end())
+		{
+			return false;
+		}
+		for (const AnimationState& state : machines[owner->second.first].states)
+		{
+			sheets.insert(state.sheet);
+		}
+		return true;
+	}
+}
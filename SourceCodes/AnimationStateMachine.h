@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AnimationStateMachine.h
+///
+/// @brief Data-driven sprite animation state machines. Machines are declared
+///        under "stateMachines" in AnimationAsset.json and compiled at load
+///        into flat, integer indexed state and transition tables, so the
+///        per-frame update compares a trigger bitmask against a short run of
+///        transitions instead of branching on entity types and sheet names.
+///
+///        An entity is driven by the machine owning the sheet its
+///        RenderComponent currently shows, so a new enemy type only needs a
+///        machine whose states use its sheets.
+///
+///        JSON:
+///          "stateMachines": [ {
+///            "name": "Boss",
+///            "states": [
+///              { "name": "idle", "sheet": "BossIdle" },                              // loops
+///              { "name": "hit", "sheet": "BossDamage", "playOnce": true, "next": "idle" }
+///            ],
+///            "transitions": [
+///              { "from": "*", "when": [ "collided" ], "to": "hit" }               // "from" is a state or "*"
+///            ] } ]
+///
+///        Triggers: "collided", "health==0" (zero or below), "health>0", with
+///        health read from the PlayerComponent or EnemyComponent. Transitions of a state
+///        are tried in declaration order and the first whose triggers all hold
+///        is taken; one into the current state does not restart it.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _ANIMATION_STATE_MACHINE_H_
+#define _ANIMATION_STATE_MACHINE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "ComponentList.h"
+
+namespace Framework {
+
+	enum AnimationTrigger : std::uint32_t
+	{
+		AnimationTriggerCollided = 1u << 0,
+		AnimationTriggerHealthZero = 1u << 1,
+		AnimationTriggerHealthAboveZero = 1u << 2
+	};
+
+	struct AnimationState
+	{
+		std::string name;
+		std::string sheet;              // Texture / AnimationAsset entry shown in this state
+		int rows = 1;
+		int cols = 1;
+		float animationSpeed = 0.0f;
+		bool playOnce = false;          // Plays one cycle, then moves to next
+		std::int16_t next = -1;
+		std::uint16_t firstTransition = 0;
+		std::uint16_t transitionCount = 0;
+	};
+
+	struct AnimationTransition
+	{
+		std::uint32_t triggers = 0;     // All of these must hold
+		std::int16_t target = -1;
+	};
+
+	struct AnimationStateMachine
+	{
+		std::string name;
+		std::vector<AnimationState> states;
+		std::vector<AnimationTransition> transitions; // Grouped per state, see AnimationState::firstTransition
+	};
+
+	// Where an entity is in its machine, -1 when its sheet belongs to none
+	struct AnimationStateInstance
+	{
+		std::int16_t machine = -1;
+		std::int16_t state = -1;
+	};
+
+	class AnimationStateMachines
+	{
+	public:
+		/**
+		 * @brief Parses and compiles the "stateMachines" of an AnimationAsset.json file, replacing any loaded before.
+		 *        Sheet sizes and speeds are copied from the AssetManager's animation data.
+		 *
+		 * @return false if the file cannot be read; a file without machines is not an error.
+		 */
+		static bool Load(const std::string& path);
+
+		static void Clear();
+
+		/**
+		 * @brief The instance of an entity, kept in sync with the sheet it currently shows.
+		 *        A sheet changed from outside (editor, scripts) re-binds the entity; a sheet
+		 *        no machine uses leaves it unbound.
+		 *
+		 * @return the instance, or nullptr if the entity is not driven by a machine.
+		 */
+		static AnimationStateInstance* Sync(Entity entity, const std::string& sheet);
+
+		/**
+		 * @brief Takes the first transition of the instance's state whose triggers all hold.
+		 *
+		 * @return true if the instance entered another state, whose animation then starts over.
+		 */
+		static bool ApplyTriggers(AnimationStateInstance& instance, std::uint32_t triggers);
+
+		/**
+		 * @brief Moves a play-once state on to its next state, called when its animation finished playing.
+		 *
+		 * @return true if the instance entered another state; a play-once state without next holds its last frame.
+		 */
+		static bool Complete(AnimationStateInstance& instance);
+
+		static const AnimationState& GetState(const AnimationStateInstance& instance) { return machines[instance.machine].states[instance.state]; }
+
+		// Trigger bit of a JSON trigger name, 0 if unknown
+		static std::uint32_t TriggerFromName(const std::string& name);
+
+		/**
+		 * @brief Adds every sheet of the machine owning a sheet, e.g. so a scene preloads the hit and death
+		 *        sheets of the enemies it contains.
+		 *
+		 * @return false if no machine uses the sheet.
+		 */
+		static bool CollectMachineSheets(const std::string& sheet, std::unordered_set<std::string>& sheets);
+
+		static const std::vector<AnimationStateMachine>& GetMachines() { return machines; }
+
+	private:
+		static std::vector<AnimationStateMachine> machines;
+
+		// Sheet -> (machine, state), the first machine declaring a sheet owns it
+		static std::unordered_map<std::string, std::pair<std::int16_t, std::int16_t>> sheetOwners;
+
+		// Indexed by entity
+		static std::vector<AnimationStateInstance> instances;
+	};
+}
+#endif // !_ANIMATION_STATE_MACHINE_H_
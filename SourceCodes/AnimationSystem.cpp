@@ -19,12 +19,19 @@
 #include "FontSystem.h" 
 #include "EngineState.h"
 #include "Graphics.h"
+#include "AnimationStateMachine.h"
+#include "AnimationPlayback.h"
+#include "EntityView.h"
+#include "ComponentTypes.h"
 
 
 extern Framework::Coordinator ecsInterface;
 
 
 namespace Framework {
+
+    // Animated entities with the Render component whose sheet they play, shared with Graphics
+    using AnimatedView = EntityView<With<AnimationComponent, RenderComponent>>;
    
     // Constructor
     AnimationSystem::AnimationSystem()
@@ -40,16 +47,23 @@ namespace Framework {
     // Initialize the system
     void AnimationSystem::Initialize() 
     {
-        ecsInterface.RegisterComponent<AnimationComponent>();
-        Signature signature;
-        signature.set(ecsInterface.GetComponentType<AnimationComponent>());
+        ComponentTypes::Register<AnimationComponent>();
+        Signature signature = SignatureOf<AnimationComponent>;
         ecsInterface.SetSystemSignature<AnimationSystem>(signature);
         std::cout << "Signature for Animation system is: " << signature << std::endl;
+        AnimatedView::Get(mEntities);
+        SystemScheduler::Add(this);
+
+        // Transitions between sheets (hit, death, idle) are data, compiled once here
+        AnimationStateMachines::Load("Assets/JsonData/AnimationAsset.json");
     }
 
     // Update the system
     void AnimationSystem::Update(float deltaTime) 
     {
+        if (SystemScheduler::Dispatch(this, deltaTime)) {
+            return;
+        }
         if (engineState.IsPaused()) {
             return;
         }
@@ -57,73 +71,119 @@ namespace Framework {
         
         std::unordered_map<std::string, EntityAsset::Animation>& animations = Framework::GlobalAssetManager.GetAnimationDataMap();
 
-        for (auto const& entityId : mEntities) 
+        // Entities without a Render component are left out by the view
+        AnimatedView& animated = AnimatedView::Get(mEntities);
+        animated.Refresh();
+        for (auto [entityId, animation, render] : animated) 
         {    
-            if (ecsInterface.HasComponent<RenderComponent>(entityId)) 
+            // Sheets owned by a state machine in AnimationAsset.json, transitions come from its compiled tables
+            if (AnimationStateInstance* instance = AnimationStateMachines::Sync(entityId, render.textureID))
             {
-                RenderComponent& render = ecsInterface.GetComponent<RenderComponent>(entityId);
-                AnimationComponent& animation = ecsInterface.GetComponent<AnimationComponent>(entityId);
-                animation.cols = animations[render.textureID].cols;
-                animation.rows = animations[render.textureID].rows;
-                animation.animationSpeed = animations[render.textureID].animationSpeed;
+                std::uint32_t triggers = 0;
+                if (CheckedHasComponent<CollisionComponent>(entityId) && CheckedGetComponent<CollisionComponent>(entityId).collided)
+                {
+                    triggers |= AnimationTriggerCollided;
+                }
 
-                if (ecsInterface.HasComponent<CollisionComponent>(entityId)) 
+                bool hasHealth = true;
+                float health = 0.0f;
+                if (CheckedHasComponent<PlayerComponent>(entityId))
+                {
+                    health = CheckedGetComponent<PlayerComponent>(entityId).health;
+                }
+                else if (CheckedHasComponent<EnemyComponent>(entityId))
+                {
+                    health = CheckedGetComponent<EnemyComponent>(entityId).health;
+                }
+                else
+                {
+                    hasHealth = false;
+                }
+                if (hasHealth)
                 {
-                    CollisionComponent& collision = ecsInterface.GetComponent<CollisionComponent>(entityId);
-                    if (ecsInterface.HasComponent<EnemyComponent>(entityId)) 
-                    {
-                        EnemyComponent& entityStats = ecsInterface.GetComponent<EnemyComponent>(entityId); 
-                        if (entityStats.type == Poison) 
-                        {
-                           UE_CollidedShortAnimation(render, collision, animation, deltaTime, animation.rows, animation.cols, animation.animationTimePlay, "PoisonDamagedIdleSprite", "PoisonDamagedIdleSprite");
-                        }
-                        if (entityStats.type == Boss) {
-                            UE_CollidedShortAnimation(render, collision, animation, deltaTime, animation.rows, animation.cols, animation.animationTimePlay, "BossDamage", "BossIdle");
-                        }
-                    }
-                    if (ecsInterface.HasComponent<PlayerComponent>(entityId)) {
-                        PlayerComponent& player = ecsInterface.GetComponent<PlayerComponent>(entityId);
-                        if (player.type == Player) 
-                        {
-                            if (player.health == 0) 
-                            {
-                               
-                                UE_CollidedShortAnimation(render, collision, animation, deltaTime, animation.rows, animation.cols, animation.animationTimePlay, "McDieSprite", "dead");
-                            }
-                            else 
-                            {
-                                UE_CollidedShortAnimation(render, collision, animation, deltaTime, animation.rows, animation.cols, animation.animationTimePlay, "McDamagedSprite", "McIdleSprite");
-                            }
-                        }
-                    }
+                    triggers |= (health <= 0) ? AnimationTriggerHealthZero : AnimationTriggerHealthAboveZero;
                 }
-            }  
+
+                bool restart = AnimationStateMachines::ApplyTriggers(*instance, triggers);
+                const AnimationState& state = AnimationStateMachines::GetState(*instance);
+                ShowState(entityId, render, animation, state, restart);
+                continue;
+            }
+
+            // One lookup per entity, sprites without animation data get the zeroed defaults operator[] used to insert
+            static const EntityAsset::Animation noAnimation{};
+            auto animationData = animations.find(render.textureID);
+            const EntityAsset::Animation& data = (animationData != animations.end()) ? animationData->second : noAnimation;
+            animation.cols = data.cols;
+            animation.rows = data.rows;
+            animation.animationSpeed = data.animationSpeed;
+
+            // A new sheet starts from its first frame
+            if (animation.currentAnimation != render.textureID)
+            {
+                animation.currentAnimation = render.textureID;
+                AnimationPlayback::Play(entityId, animation.rows * animation.cols, animation.animationSpeed, AnimationLoopMode::Loop);
+            }
+            else
+            {
+                AnimationPlayback::Sync(entityId, animation.rows * animation.cols, animation.animationSpeed, AnimationLoopMode::Loop);
+            }
         } 
-    }
 
-    // Get the name of the system
-    std::string AnimationSystem::GetName() {
-        return "Animation System";
+        // Entities destroyed or stripped of their components since the last update
+        AnimationPlayback::Sweep();
+
+        // Every animation advances in one pass, then only entities whose frame changed or which finished are visited
+        AnimationPlayback::Advance(deltaTime);
+        for (const AnimationPlaybackEvent& event : AnimationPlayback::GetEvents())
+        {
+            const AnimatedView::Row* row = animated.Find(event.entity);
+            if (!row)
+            {
+                continue;
+            }
+            AnimationComponent& animation = row->Get<AnimationComponent>();
+            animation.currentFrame = event.frame;
+
+            if (event.flags & AnimationFinished)
+            {
+                RenderComponent& render = row->Get<RenderComponent>();
+                AnimationStateInstance* instance = AnimationStateMachines::Sync(event.entity, render.textureID);
+                if (instance && AnimationStateMachines::Complete(*instance))
+                {
+                    ShowState(event.entity, render, animation, AnimationStateMachines::GetState(*instance), true);
+                }
+            }
+        }
     }
 
-    void AnimationSystem::UE_CollidedShortAnimation(RenderComponent& render, CollisionComponent& collision, AnimationComponent& animation, float deltaTime, int rows, int cols, float animationTime, std::string animationPlayed, std::string defaultAnimation) {
-        (void)rows, cols, animationTime;
-        if (collision.collided) 
+    void AnimationSystem::ShowState(Entity entity, RenderComponent& render, AnimationComponent& animation, const AnimationState& state, bool restart)
+    {
+        if (render.textureID != state.sheet)
         {
-            render.textureID = animationPlayed;
+            render.textureID = state.sheet;
         }
-        if (render.textureID == animationPlayed) 
+        animation.cols = state.cols;
+        animation.rows = state.rows;
+        animation.animationSpeed = state.animationSpeed;
+
+        // Entering a state restarts its animation even when it shares the sheet of the previous one
+        restart = restart || animation.currentAnimation != state.sheet;
+        AnimationLoopMode mode = state.playOnce ? AnimationLoopMode::Once : AnimationLoopMode::Loop;
+        if (restart)
         {
-            int totalFrames = animation.cols * animation.rows;
-            (void)totalFrames;
-            animation.animationTimePlay = animation.animationTimePlay + deltaTime;
-            animation.currentFrame = (int)(animation.animationTimePlay * animation.animationSpeed) % (animation.rows * animation.cols);
-            if (animation.currentFrame >= ((animation.rows * animation.cols) - 1)) 
-            {
-                render.textureID = defaultAnimation;
-                animation.currentFrame = 0;
-                animation.animationTimePlay = 0;
-            }
+            animation.currentAnimation = state.sheet;
+            animation.currentFrame = 0;
+            AnimationPlayback::Play(entity, state.rows * state.cols, state.animationSpeed, mode);
+        }
+        else
+        {
+            AnimationPlayback::Sync(entity, state.rows * state.cols, state.animationSpeed, mode);
         }
     }
+
+    // Get the name of the system
+    std::string AnimationSystem::GetName() {
+        return "Animation System";
+    }
 }
\ No newline at end of file
@@ -15,12 +15,24 @@
 #include "Vector2D.h"
 #include "InputHandler.h"
 #include "ComponentList.h"
+#include "SystemScheduler.h"
 
 namespace Framework 
 {
+    struct AnimationState;
+
     class AnimationSystem : public ISystem 
     {
     public:
+        // Hit and health triggers are read, sheets and frames written; AnimationPlayback is only touched from here.
+        // Of RenderComponent only the sheet (textureID) is written, so timelines fading the same sprites run beside it
+        static constexpr SystemAccess Access{
+            SignatureOf<CollisionComponent, PlayerComponent, EnemyComponent>,
+            SignatureOf<AnimationComponent, RenderComponent>,
+            SystemNoFlags,
+            SignatureOf<RenderComponent>,
+            FieldRenderSheet };
+
         AnimationSystem();
         ~AnimationSystem();
 
@@ -28,23 +40,8 @@ namespace Framework
         void Update(float deltaTime) override;
         std::string GetName() override;
 
-        /**
-        * @brief Run the selected animation for 1 cycle
-        *
-        * This function takes in the name of 2 sprite sheet. The first sprite sheet will be played once and 2nd will be played all the way.
-        *
-        * @param render : Render component of the object
-        * @param collision : collision component of the object
-        * @param animation : animation component of the object
-        * @param deltaTime : total time per frame
-        * @param rows : the amount of rows in the spritesheet
-        * @param cols : the amount of cols in the spritesheet
-        * @param animationTime : the total time passed since the animation has changed
-        * @param animationPlayed : the name of the sprite sheet that will be played one cycle
-        * @param defaultAnimation : the name of the sprite sheet that will be played all the way after the first animation has been played once.
-        *
-        */
-
-        void UE_CollidedShortAnimation(RenderComponent& render, CollisionComponent& collision, AnimationComponent& animation, float deltaTime, int rows, int cols, float animationTime, std::string animationPlayed, std::string defaultAnimation);
+    private:
+        // Shows a state machine state on the entity, starting its animation over when restart is set or the sheet changed
+        void ShowState(Entity entity, RenderComponent& render, AnimationComponent& animation, const AnimationState& state, bool restart);
     };
 }
\ No newline at end of file
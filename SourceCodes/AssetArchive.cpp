@@ -0,0 +1,251 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AssetArchive.cpp
+///
+/// @brief Memory-mapped asset pack: mounting, lookup, reading with loose file
+///        fallback, and writing.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "AssetArchive.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include "Lz4Block.h"
+
+namespace Framework {
+
+	MappedFile AssetArchive::file{};
+	const AssetArchiveHeader* AssetArchive::header{};
+	const AssetArchiveEntry* AssetArchive::entries{};
+	const char* AssetArchive::paths{};
+
+	static std::size_t AlignUp(std::size_t value, std::size_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	std::string AssetArchive::NormalizePath(const std::string& path)
+	{
+		std::string normalized = path;
+		std::replace(normalized.begin(), normalized.end(), '\\', '/');
+		while (normalized.compare(0, 2, "./") == 0)
+		{
+			normalized.erase(0, 2);
+		}
+		return normalized;
+	}
+
+	std::uint64_t AssetArchive::HashPath(const std::string& path)
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		for (unsigned char c : path)
+		{
+			hash ^= c;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	bool AssetArchive::Mount(const std::string& path)
+	{
+		Unmount();
+		if (!file.Open(path) || file.Size() < sizeof(AssetArchiveHeader))
+		{
+			file.Close();
+			return false;
+		}
+
+		const AssetArchiveHeader* candidate = reinterpret_cast<const AssetArchiveHeader*>(file.Data());
+		std::size_t tableEnd = sizeof(AssetArchiveHeader) + sizeof(AssetArchiveEntry) * static_cast<std::size_t>(candidate->entryCount);
+		if (candidate->magic != FileMagic || candidate->version != FileVersion || tableEnd > file.Size()
+			|| candidate->pathsOffset + candidate->pathsSize > file.Size())
+		{
+			std::cout << "Asset archive " << path << " is not a valid archive, using loose files" << std::endl;
+			file.Close();
+			return false;
+		}
+
+		const AssetArchiveEntry* table = reinterpret_cast<const AssetArchiveEntry*>(file.Data() + sizeof(AssetArchiveHeader));
+		for (std::uint32_t i = 0; i < candidate->entryCount; ++i)
+		{
+			if (table[i].offset + table[i].storedSize > file.Size()
+				|| static_cast<std::uint64_t>(table[i].pathOffset) + table[i].pathLength > candidate->pathsSize)
+			{
+				std::cout << "Asset archive " << path << " is damaged, using loose files" << std::endl;
+				file.Close();
+				return false;
+			}
+		}
+
+		header = candidate;
+		entries = table;
+		paths = reinterpret_cast<const char*>(file.Data() + candidate->pathsOffset);
+		std::cout << "Mounted asset archive " << path << " (" << header->entryCount << " entries)" << std::endl;
+		return true;
+	}
+
+	void AssetArchive::Unmount()
+	{
+		header = nullptr;
+		entries = nullptr;
+		paths = nullptr;
+		file.Close();
+	}
+
+	const AssetArchiveEntry* AssetArchive::Find(const std::string& path)
+	{
+		if (!header)
+		{
+			return nullptr;
+		}
+
+		std::string normalized = NormalizePath(path);
+		std::uint64_t hash = HashPath(normalized);
+		const AssetArchiveEntry* end = entries + header->entryCount;
+		const AssetArchiveEntry* it = std::lower_bound(entries, end, hash, [](const AssetArchiveEntry& entry, std::uint64_t value)
+		{
+			return entry.pathHash < value;
+		});
+
+		// Hashes can collide, the stored path decides
+		for (; it != end && it->pathHash == hash; ++it)
+		{
+			if (normalized.compare(0, std::string::npos, paths + it->pathOffset, it->pathLength) == 0)
+			{
+				return it;
+			}
+		}
+		return nullptr;
+	}
+
+	bool AssetArchive::Open(const std::string& path, AssetData& asset)
+	{
+		asset.data = nullptr;
+		asset.size = 0;
+		asset.decompressed.clear();
+		asset.looseFile.Close();
+
+		if (const AssetArchiveEntry* entry = Find(path))
+		{
+			const std::uint8_t* stored = file.Data() + entry->offset;
+			switch (entry->compression)
+			{
+			case AssetCompression::None:
+				asset.data = stored;
+				asset.size = static_cast<std::size_t>(entry->size);
+				return true;
+
+			case AssetCompression::LZ4:
+				asset.decompressed.resize(static_cast<std::size_t>(entry->size));
+				if (!Lz4Block::Decompress(stored, static_cast<std::size_t>(entry->storedSize), asset.decompressed.data(), asset.decompressed.size()))
+				{
+					std::cout << "Asset archive entry " << path << " is damaged" << std::endl;
+					asset.decompressed.clear();
+					return false;
+				}
+				asset.data = asset.decompressed.data();
+				asset.size = asset.decompressed.size();
+				return true;
+			}
+			return false;
+		}
+
+		if (!asset.looseFile.Open(path))
+		{
+			return false;
+		}
+		asset.data = asset.looseFile.Data();
+		asset.size = asset.looseFile.Size();
+		return true;
+	}
+
+	bool AssetArchive::Exists(const std::string& path)
+	{
+		return Find(path) != nullptr || std::ifstream(path).good();
+	}
+
+	bool AssetArchive::Write(const std::string& path, const std::vector<AssetArchiveSource>& sources, bool compress)
+	{
+		std::vector<AssetArchiveEntry> table(sources.size());
+		std::string pathStrings;
+		for (std::size_t i = 0; i < sources.size(); ++i)
+		{
+			std::string archivePath = NormalizePath(sources[i].archivePath);
+			table[i] = {};
+			table[i].pathHash = HashPath(archivePath);
+			table[i].pathOffset = static_cast<std::uint32_t>(pathStrings.size());
+			table[i].pathLength = static_cast<std::uint32_t>(archivePath.size());
+			pathStrings += archivePath;
+		}
+
+		std::ofstream output(path, std::ios::binary | std::ios::trunc);
+		if (!output)
+		{
+			return false;
+		}
+
+		// Header and table are written last, once the entry offsets are known
+		std::size_t pathsOffset = sizeof(AssetArchiveHeader) + sizeof(AssetArchiveEntry) * table.size();
+		std::size_t offset = AlignUp(pathsOffset + pathStrings.size(), DataAlignment);
+		output.seekp(static_cast<std::streamoff>(pathsOffset));
+		output.write(pathStrings.data(), static_cast<std::streamsize>(pathStrings.size()));
+
+		std::vector<std::uint8_t> compressed;
+		for (std::size_t i = 0; i < sources.size(); ++i)
+		{
+			std::ifstream input(sources[i].filePath, std::ios::binary);
+			if (!input)
+			{
+				std::cerr << "Cannot read " << sources[i].filePath << std::endl;
+				return false;
+			}
+			std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+			const std::uint8_t* stored = bytes.data();
+			std::size_t storedSize = bytes.size();
+			table[i].compression = AssetCompression::None;
+			if (compress && !bytes.empty())
+			{
+				// Already compressed formats (PNG, OGG, MP3) barely shrink, they stay directly mappable
+				compressed.resize(Lz4Block::CompressBound(bytes.size()));
+				std::size_t compressedSize = Lz4Block::Compress(bytes.data(), bytes.size(), compressed.data());
+				if (compressedSize <= bytes.size() - bytes.size() / 8)
+				{
+					stored = compressed.data();
+					storedSize = compressedSize;
+					table[i].compression = AssetCompression::LZ4;
+				}
+			}
+
+			table[i].offset = offset;
+			table[i].storedSize = storedSize;
+			table[i].size = bytes.size();
+			output.seekp(static_cast<std::streamoff>(offset));
+			output.write(reinterpret_cast<const char*>(stored), static_cast<std::streamsize>(storedSize));
+			offset = AlignUp(offset + storedSize, DataAlignment);
+		}
+
+		std::sort(table.begin(), table.end(), [](const AssetArchiveEntry& a, const AssetArchiveEntry& b)
+		{
+			return a.pathHash < b.pathHash;
+		});
+
+		AssetArchiveHeader archiveHeader{};
+		archiveHeader.magic = FileMagic;
+		archiveHeader.version = FileVersion;
+		archiveHeader.entryCount = static_cast<std::uint32_t>(table.size());
+		archiveHeader.pathsOffset = pathsOffset;
+		archiveHeader.pathsSize = pathStrings.size();
+
+		output.seekp(0);
+		output.write(reinterpret_cast<const char*>(&archiveHeader), sizeof(archiveHeader));
+		output.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(sizeof(AssetArchiveEntry) * table.size()));
+		return static_cast<bool>(output);
+	}
+}
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AssetArchive.h
+///
+/// @brief Single-file asset pack built by the AssetPacker tool. The archive is
+///        memory mapped once at startup; its table of contents is sorted by
+///        path hash and searched in place, and stored entries are read
+///        straight out of the mapping. Entries that shrink enough are LZ4
+///        compressed and decompressed on open.
+///
+///        Layout:
+///          AssetArchiveHeader
+///          AssetArchiveEntry[entryCount], sorted by pathHash
+///          path strings (not terminated, addressed by pathOffset / pathLength)
+///          entry data, each entry aligned to AssetArchive::DataAlignment
+///
+///        Paths are relative to the working directory with forward slashes,
+///        the same strings the engine already uses ("Assets/Images/Logo.png").
+///        Without a mounted archive, or for paths it does not contain, assets
+///        are read from loose files so development keeps working unpacked.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _ASSET_ARCHIVE_H_
+#define _ASSET_ARCHIVE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+namespace Framework {
+
+	enum class AssetCompression : std::uint32_t
+	{
+		None = 0,
+		LZ4 = 1
+	};
+
+	struct AssetArchiveHeader
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint32_t entryCount;
+		std::uint32_t reserved;
+		std::uint64_t pathsOffset;
+		std::uint64_t pathsSize;
+	};
+
+	struct AssetArchiveEntry
+	{
+		std::uint64_t pathHash;
+		std::uint64_t offset;           // From the start of the archive
+		std::uint64_t storedSize;       // Bytes in the archive
+		std::uint64_t size;             // Bytes once decompressed
+		std::uint32_t pathOffset;       // Into the path strings
+		std::uint32_t pathLength;
+		AssetCompression compression;
+		std::uint32_t reserved;
+	};
+
+	// A file to add to an archive
+	struct AssetArchiveSource
+	{
+		std::string archivePath;        // Key the engine looks the asset up by
+		std::string filePath;           // Where the packer reads it from
+	};
+
+	// Bytes of an opened asset, pointing into the archive mapping, a decompressed copy or a mapped loose file
+	class AssetData
+	{
+	public:
+		const std::uint8_t* Data() const { return data; }
+		std::size_t Size() const { return size; }
+		bool IsValid() const { return data != nullptr; }
+
+		// Convenience for text assets (shaders, JSON)
+		std::string AsString() const { return std::string(reinterpret_cast<const char*>(data), size); }
+
+	private:
+		friend class AssetArchive;
+
+		const std::uint8_t* data = nullptr;
+		std::size_t size = 0;
+		std::vector<std::uint8_t> decompressed;
+		MappedFile looseFile;
+	};
+
+	class AssetArchive
+	{
+	public:
+		static constexpr std::uint32_t FileMagic = 0x4B415055; // "UPAK"
+		static constexpr std::uint32_t FileVersion = 1;
+		static constexpr std::size_t DataAlignment = 16;
+
+		/**
+		 * @brief Maps an archive and validates its table of contents. A previously mounted archive is unmounted.
+		 *
+		 * @return false if the file is missing or invalid; assets are then read from loose files.
+		 */
+		static bool Mount(const std::string& path);
+
+		static void Unmount();
+
+		static bool IsMounted() { return header != nullptr; }
+
+		/**
+		 * @brief Finds an entry by path in the mounted archive.
+		 *
+		 * @return the entry, or nullptr if no archive is mounted or it has no such path.
+		 */
+		static const AssetArchiveEntry* Find(const std::string& path);
+
+		/**
+		 * @brief Opens an asset from the mounted archive, falling back to the loose file.
+		 *        Uncompressed entries are not copied, the returned data points into the mapping
+		 *        and stays valid until the archive is unmounted.
+		 *
+		 * @return false if the asset exists in neither place or its entry is damaged.
+		 */
+		static bool Open(const std::string& path, AssetData& asset);
+
+		// Whether Open would find the asset, without reading it
+		static bool Exists(const std::string& path);
+
+		static std::uint32_t GetEntryCount() { return header ? header->entryCount : 0; }
+
+		/**
+		 * @brief Writes an archive of the given files, LZ4 compressing entries that shrink by
+		 *        at least an eighth when compress is set. Used by the AssetPacker tool.
+		 *
+		 * @return false if a source could not be read or the archive could not be written.
+		 */
+		static bool Write(const std::string& path, const std::vector<AssetArchiveSource>& sources, bool compress);
+
+		// 64-bit FNV-1a of the normalised path
+		static std::uint64_t HashPath(const std::string& path);
+
+		// Forward slashes and no leading "./", the form paths are stored in
+		static std::string NormalizePath(const std::string& path);
+
+	private:
+		static MappedFile file;
+		static const AssetArchiveHeader* header;
+		static const AssetArchiveEntry* entries;
+		static const char* paths;
+	};
+}
+#endif // !_ASSET_ARCHIVE_H_
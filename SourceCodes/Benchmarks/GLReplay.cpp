@@ -0,0 +1,560 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GLReplay.cpp
+///
+/// @brief Standalone replayer for GL frame captures written by GLCapture
+///        (editor "Capture GL Frame" button or F11). Recreates the captured
+///        programs, buffers, VAOs and textures once, then re-issues the frame's
+///        command stream N times into an offscreen framebuffer on a headless
+///        context and reports CPU (submit + glFinish) and GPU frame times.
+///
+///        Usage:
+///          GLReplay capture.glcap [--headless=egl|osmesa] [--iterations N]
+///                                 [--warmup N] [--out results.json] [--dump]
+///
+///        Uniform locations are looked up once per program and cached, so the
+///        timings cover the GL stream itself rather than the engine's lookups.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Coordinator.h"
+#include "GraphicsWindows.h"
+#include "GLCapture.h"
+#include "HeadlessBenchmark.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/prettywriter.h"
+
+// The engine's main translation unit is not linked into this executable
+Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+    // Captured GL names mapped to the names created by the replayer
+    struct ReplayState
+    {
+        std::unordered_map<GLuint, GLuint> programs;
+        std::unordered_map<GLuint, GLuint> buffers;
+        std::unordered_map<GLuint, GLuint> vertexArrays;
+        std::unordered_map<GLuint, GLuint> textures;
+        std::unordered_map<GLuint, GLuint> samplers;
+        std::map<std::pair<GLuint, std::string>, GLint> uniformLocations;
+        GLuint currentProgram = 0;
+    };
+
+    static GLuint Remap(const std::unordered_map<GLuint, GLuint>& names, GLuint captured)
+    {
+        auto it = names.find(captured);
+        return it != names.end() ? it->second : 0;
+    }
+
+    static GLint UniformLocation(ReplayState& state, const std::string& name)
+    {
+        auto key = std::make_pair(state.currentProgram, name);
+        auto it = state.uniformLocations.find(key);
+        if (it != state.uniformLocations.end())
+        {
+            return it->second;
+        }
+        GLint location = glGetUniformLocation(state.currentProgram, name.c_str());
+        state.uniformLocations.emplace(key, location);
+        return location;
+    }
+
+    static GLuint CreateProgram(GLCaptureReader& reader)
+    {
+        GLuint program = glCreateProgram();
+        std::uint32_t shaderCount = reader.Read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < shaderCount; ++i)
+        {
+            GLenum type = reader.Read<GLenum>();
+            std::string source = reader.ReadString();
+            const char* text = source.c_str();
+
+            GLuint shader = glCreateShader(type);
+            glShaderSource(shader, 1, &text, nullptr);
+            glCompileShader(shader);
+            glAttachShader(program, shader);
+            glDeleteShader(shader);
+        }
+        glLinkProgram(program);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked == GL_FALSE)
+        {
+            std::cerr << "Captured program failed to link on this driver" << std::endl;
+        }
+        return program;
+    }
+
+    static GLuint CreateVertexArray(GLCaptureReader& reader, const ReplayState& state)
+    {
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+
+        GLuint attribCount = reader.Read<GLuint>();
+        for (GLuint i = 0; i < attribCount; ++i)
+        {
+            GLint enabled = reader.Read<GLint>();
+            GLint size = reader.Read<GLint>();
+            GLint type = reader.Read<GLint>();
+            GLint normalized = reader.Read<GLint>();
+            GLint relativeOffset = reader.Read<GLint>();
+            GLint bindingIndex = reader.Read<GLint>();
+            GLint buffer = reader.Read<GLint>();
+            GLint stride = reader.Read<GLint>();
+            GLint64 offset = reader.Read<GLint64>();
+
+            if (enabled)
+            {
+                glEnableVertexArrayAttrib(vao, i);
+            }
+            glVertexArrayAttribFormat(vao, i, size, static_cast<GLenum>(type), normalized ? GL_TRUE : GL_FALSE, relativeOffset);
+            glVertexArrayAttribBinding(vao, i, bindingIndex);
+
+            GLuint replayBuffer = Remap(state.buffers, static_cast<GLuint>(buffer));
+            if (replayBuffer != 0)
+            {
+                glVertexArrayVertexBuffer(vao, i, replayBuffer, static_cast<GLintptr>(offset), stride);
+            }
+        }
+
+        GLuint elementBuffer = Remap(state.buffers, static_cast<GLuint>(reader.Read<GLint>()));
+        if (elementBuffer != 0)
+        {
+            glVertexArrayElementBuffer(vao, elementBuffer);
+        }
+        return vao;
+    }
+
+    static GLuint CreateTexture(GLCaptureReader& reader)
+    {
+        GLint width = reader.Read<GLint>();
+        GLint height = reader.Read<GLint>();
+        GLint levels = reader.Read<GLint>();
+        std::uint32_t size = 0;
+        const std::uint8_t* pixels = reader.ReadBlob(size);
+
+        GLuint texture = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        if (width > 0 && height > 0)
+        {
+            glTextureStorage2D(texture, levels, GL_RGBA8, width, height);
+            glTextureSubImage2D(texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+            if (levels > 1)
+            {
+                glGenerateTextureMipmap(texture);
+            }
+        }
+        return texture;
+    }
+
+    static GLuint CreateSampler(GLCaptureReader& reader)
+    {
+        GLuint sampler = 0;
+        glCreateSamplers(1, &sampler);
+        glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, reader.Read<GLint>());
+        glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, reader.Read<GLint>());
+        glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, reader.Read<GLint>());
+        glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, reader.Read<GLint>());
+        return sampler;
+    }
+
+    static GLuint CreateBuffer(const std::uint8_t* data, std::uint32_t size)
+    {
+        GLuint buffer = 0;
+        glCreateBuffers(1, &buffer);
+        glNamedBufferStorage(buffer, size, data, GL_DYNAMIC_STORAGE_BIT);
+        return buffer;
+    }
+
+    // Executes one command. Resource snapshots are only created the first time they are seen.
+    static void Execute(const GLCaptureCommand& command, ReplayState& state)
+    {
+        GLCaptureReader reader(command.payload);
+
+        switch (command.type)
+        {
+        case GLCommandType::CreateProgram:
+        {
+            GLuint captured = reader.Read<GLuint>();
+            if (state.programs.find(captured) == state.programs.end())
+            {
+                state.programs[captured] = CreateProgram(reader);
+            }
+            break;
+        }
+        case GLCommandType::CreateBuffer:
+        {
+            GLuint captured = reader.Read<GLuint>();
+            std::uint32_t size = 0;
+            const std::uint8_t* data = reader.ReadBlob(size);
+            if (state.buffers.find(captured) == state.buffers.end())
+            {
+                state.buffers[captured] = CreateBuffer(data, size);
+            }
+            break;
+        }
+        case GLCommandType::CreateVertexArray:
+        {
+            GLuint captured = reader.Read<GLuint>();
+            if (state.vertexArrays.find(captured) == state.vertexArrays.end())
+            {
+                state.vertexArrays[captured] = CreateVertexArray(reader, state);
+            }
+            break;
+        }
+        case GLCommandType::CreateTexture:
+        {
+            GLuint captured = reader.Read<GLuint>();
+            if (state.textures.find(captured) == state.textures.end())
+            {
+                state.textures[captured] = CreateTexture(reader);
+            }
+            break;
+        }
+        case GLCommandType::CreateSampler:
+        {
+            GLuint captured = reader.Read<GLuint>();
+            if (state.samplers.find(captured) == state.samplers.end())
+            {
+                state.samplers[captured] = CreateSampler(reader);
+            }
+            break;
+        }
+        case GLCommandType::BufferData:
+        {
+            // Mirrors the engine's per-draw create/delete of the animation texcoord buffer
+            GLuint captured = reader.Read<GLuint>();
+            std::uint32_t size = 0;
+            const std::uint8_t* data = reader.ReadBlob(size);
+            auto it = state.buffers.find(captured);
+            if (it != state.buffers.end())
+            {
+                glDeleteBuffers(1, &it->second);
+            }
+            state.buffers[captured] = CreateBuffer(data, size);
+            break;
+        }
+        case GLCommandType::VertexArrayVertexBuffer:
+        {
+            GLuint vao = Remap(state.vertexArrays, reader.Read<GLuint>());
+            GLuint bindingIndex = reader.Read<GLuint>();
+            GLuint buffer = Remap(state.buffers, reader.Read<GLuint>());
+            GLint64 offset = reader.Read<GLint64>();
+            GLsizei stride = reader.Read<GLsizei>();
+            glVertexArrayVertexBuffer(vao, bindingIndex, buffer, static_cast<GLintptr>(offset), stride);
+            break;
+        }
+        case GLCommandType::UseProgram:
+            state.currentProgram = Remap(state.programs, reader.Read<GLuint>());
+            glUseProgram(state.currentProgram);
+            break;
+        case GLCommandType::BindVertexArray:
+            glBindVertexArray(Remap(state.vertexArrays, reader.Read<GLuint>()));
+            break;
+        case GLCommandType::BindTexture:
+            glBindTexture(GL_TEXTURE_2D, Remap(state.textures, reader.Read<GLuint>()));
+            break;
+        case GLCommandType::BindSampler:
+            glBindSampler(0, Remap(state.samplers, reader.Read<GLuint>()));
+            break;
+        case GLCommandType::Uniform1i:
+        {
+            reader.Read<GLuint>();
+            std::string name = reader.ReadString();
+            glUniform1i(UniformLocation(state, name), reader.Read<GLint>());
+            break;
+        }
+        case GLCommandType::Uniform1f:
+        {
+            reader.Read<GLuint>();
+            std::string name = reader.ReadString();
+            glUniform1f(UniformLocation(state, name), reader.Read<GLfloat>());
+            break;
+        }
+        case GLCommandType::Uniform3f:
+        {
+            reader.Read<GLuint>();
+            std::string name = reader.ReadString();
+            GLfloat x = reader.Read<GLfloat>();
+            GLfloat y = reader.Read<GLfloat>();
+            GLfloat z = reader.Read<GLfloat>();
+            glUniform3f(UniformLocation(state, name), x, y, z);
+            break;
+        }
+        case GLCommandType::UniformMatrix4f:
+        {
+            reader.Read<GLuint>();
+            std::string name = reader.ReadString();
+            GLfloat matrix[16];
+            reader.ReadBytes(matrix, sizeof(matrix));
+            glUniformMatrix4fv(UniformLocation(state, name), 1, GL_FALSE, matrix);
+            break;
+        }
+        case GLCommandType::Enable:
+            glEnable(reader.Read<GLenum>());
+            break;
+        case GLCommandType::BlendFunc:
+        {
+            GLenum source = reader.Read<GLenum>();
+            GLenum destination = reader.Read<GLenum>();
+            glBlendFunc(source, destination);
+            break;
+        }
+        case GLCommandType::PointSize:
+            glPointSize(reader.Read<GLfloat>());
+            break;
+        case GLCommandType::LineWidth:
+            glLineWidth(reader.Read<GLfloat>());
+            break;
+        case GLCommandType::Clear:
+        {
+            GLbitfield mask = reader.Read<GLbitfield>();
+            GLfloat color[4];
+            reader.ReadBytes(color, sizeof(color));
+            glClearColor(color[0], color[1], color[2], color[3]);
+            glClear(mask);
+            break;
+        }
+        case GLCommandType::DrawArrays:
+        {
+            GLenum mode = reader.Read<GLenum>();
+            GLint first = reader.Read<GLint>();
+            GLsizei count = reader.Read<GLsizei>();
+            glDrawArrays(mode, first, count);
+            break;
+        }
+        case GLCommandType::DrawElements:
+        {
+            GLenum mode = reader.Read<GLenum>();
+            GLsizei count = reader.Read<GLsizei>();
+            glDrawElements(mode, count, GL_UNSIGNED_INT, nullptr);
+            break;
+        }
+        default:
+            std::cerr << "Skipping unknown GL capture command " << static_cast<int>(command.type) << std::endl;
+            break;
+        }
+    }
+
+    static void DumpCapture(const GLCaptureFile& capture)
+    {
+        std::map<std::string, std::pair<std::size_t, std::size_t>> perType; // count, payload bytes
+        for (const GLCaptureCommand& command : capture.commands)
+        {
+            auto& entry = perType[GLCapture::CommandName(command.type)];
+            ++entry.first;
+            entry.second += command.payload.size();
+        }
+
+        std::cout << "Capture " << capture.width << "x" << capture.height << ", " << capture.commands.size() << " commands" << std::endl;
+        for (const auto& [name, entry] : perType)
+        {
+            std::cout << "  " << name << ": " << entry.first << " (" << entry.second << " bytes)" << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Framework;
+
+    std::string capturePath;
+    std::string outputPath;
+    int iterations = 500;
+    int warmupIterations = 20;
+    bool dump = false;
+
+    // Context selection is shared with the engine's headless mode
+    HeadlessBenchmark::settings.enabled = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--headless=osmesa")
+        {
+            HeadlessBenchmark::settings.context = HeadlessContext::OSMesa;
+        }
+        else if (arg == "--headless" || arg == "--headless=egl")
+        {
+            HeadlessBenchmark::settings.context = HeadlessContext::EGL;
+        }
+        else if (arg == "--iterations" && hasValue)
+        {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--warmup" && hasValue)
+        {
+            warmupIterations = std::max(0, std::atoi(argv[++i]));
+        }
+        else if (arg == "--out" && hasValue)
+        {
+            outputPath = argv[++i];
+        }
+        else if (arg == "--dump")
+        {
+            dump = true;
+        }
+        else if (capturePath.empty() && arg.rfind("--", 0) != 0)
+        {
+            capturePath = arg;
+        }
+        else
+        {
+            std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+        }
+    }
+
+    if (capturePath.empty())
+    {
+        std::cerr << "Usage: GLReplay capture.glcap [--headless=egl|osmesa] [--iterations N] [--warmup N] [--out results.json] [--dump]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    GLCaptureFile capture;
+    if (!GLCapture::Load(capturePath, capture))
+    {
+        return EXIT_FAILURE;
+    }
+    if (dump)
+    {
+        DumpCapture(capture);
+    }
+
+    Window::WindowConfig config{};
+    config.x = static_cast<int>(capture.width);
+    config.y = static_cast<int>(capture.height);
+    config.programName = "GLReplay";
+
+    // No CoreEngine here, the replayer drives the frames itself
+    GraphicsWindows windows(config, nullptr);
+    if (glewInit() != GLEW_OK)
+    {
+        std::cerr << "Unable to initialize GLEW" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Offscreen target matching the captured game framebuffer
+    GLuint framebuffer = 0, colorTexture = 0, depthBuffer = 0;
+    glCreateFramebuffers(1, &framebuffer);
+    glCreateTextures(GL_TEXTURE_2D, 1, &colorTexture);
+    glTextureStorage2D(colorTexture, 1, GL_RGBA8, capture.width, capture.height);
+    glCreateRenderbuffers(1, &depthBuffer);
+    glNamedRenderbufferStorage(depthBuffer, GL_DEPTH24_STENCIL8, capture.width, capture.height);
+    glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0, colorTexture, 0);
+    glNamedFramebufferRenderbuffer(framebuffer, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, capture.width, capture.height);
+
+    GLuint timerQuery = 0;
+    glGenQueries(1, &timerQuery);
+
+    ReplayState state;
+    std::vector<double> cpuTimes;
+    std::vector<double> gpuTimes;
+    cpuTimes.reserve(iterations);
+    gpuTimes.reserve(iterations);
+
+    try
+    {
+        for (int iteration = 0; iteration < warmupIterations + iterations; ++iteration)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            glBeginQuery(GL_TIME_ELAPSED, timerQuery);
+
+            for (const GLCaptureCommand& command : capture.commands)
+            {
+                Execute(command, state);
+            }
+
+            glEndQuery(GL_TIME_ELAPSED);
+            glFinish();
+            auto end = std::chrono::high_resolution_clock::now();
+
+            GLuint64 gpuNs = 0;
+            glGetQueryObjectui64v(timerQuery, GL_QUERY_RESULT, &gpuNs);
+
+            // The first iteration also creates every snapshotted resource
+            if (iteration >= warmupIterations && iteration > 0)
+            {
+                cpuTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+                gpuTimes.push_back(static_cast<double>(gpuNs) / 1.0e6);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Replay failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    FrameTimeSummary cpu = HeadlessBenchmark::Summarize(cpuTimes);
+    FrameTimeSummary gpu = HeadlessBenchmark::Summarize(gpuTimes);
+
+    std::cout << "Replayed " << capturePath << " " << cpu.frames << " times on "
+        << reinterpret_cast<const char*>(glGetString(GL_RENDERER)) << std::endl;
+    std::cout << "  cpu ms: mean " << cpu.mean << "  p50 " << cpu.p50 << "  p95 " << cpu.p95 << "  max " << cpu.max << std::endl;
+    std::cout << "  gpu ms: mean " << gpu.mean << "  p50 " << gpu.p50 << "  p95 " << gpu.p95 << "  max " << gpu.max << std::endl;
+
+    if (!outputPath.empty())
+    {
+        std::ofstream file(outputPath);
+        if (!file)
+        {
+            std::cerr << "Failed to open replay results file: " << outputPath << std::endl;
+            return EXIT_FAILURE;
+        }
+        // Capture paths and driver strings are escaped by the writer
+        const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        rapidjson::OStreamWrapper stream(file);
+        rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(stream);
+        writer.SetIndent(' ', 2);
+        writer.StartObject();
+        writer.Key("capture");
+        writer.String(capturePath.c_str());
+        writer.Key("renderer");
+        writer.String(renderer ? renderer : "");
+        writer.Key("commands");
+        writer.Uint64(static_cast<std::uint64_t>(capture.commands.size()));
+        writer.Key("iterations");
+        writer.Uint64(static_cast<std::uint64_t>(cpu.frames));
+        writer.Key("cpu_mean_ms");
+        writer.Double(cpu.mean);
+        writer.Key("cpu_p50_ms");
+        writer.Double(cpu.p50);
+        writer.Key("cpu_p95_ms");
+        writer.Double(cpu.p95);
+        writer.Key("gpu_mean_ms");
+        writer.Double(gpu.mean);
+        writer.Key("gpu_p50_ms");
+        writer.Double(gpu.p50);
+        writer.Key("gpu_p95_ms");
+        writer.Double(gpu.p95);
+        writer.EndObject();
+        file << "\n";
+    }
+
+    glDeleteQueries(1, &timerQuery);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteTextures(1, &colorTexture);
+    glDeleteRenderbuffers(1, &depthBuffer);
+    return EXIT_SUCCESS;
+}
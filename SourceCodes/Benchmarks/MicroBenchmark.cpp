@@ -0,0 +1,545 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file MicroBenchmark.cpp
+///
+/// @brief Standalone micro-benchmark executable for the engine's hot kernels:
+///        calculate2DTransform, the render layer sort, the packed animation
+///        frame advance, timeline easing behaviors, the tween
+///        engine, the timer wheel, coroutine sequences, ECS component access and
+///        views, tag checks and texture name lookups. Each kernel runs over several input sizes and reports
+///        ns/op and heap allocations/op.
+///
+///        Usage:
+///          MicroBenchmark [--filter substring] [--min-time-ms 200]
+///
+///        None of the kernels below touch OpenGL, so no context is created.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Coordinator.h"
+#include "ComponentList.h"
+#include "EngineState.h"
+#include "Graphics.h"
+#include "AnimationPlayback.h"
+#include "TweenEngine.h"
+#include "TimerWheel.h"
+#include "SequenceScheduler.h"
+#include "TagIndex.h"
+#include "EntityView.h"
+#include "ComponentTypes.h"
+#include "TimelineBehavior.h"
+
+// The engine's main translation unit is not linked into this executable
+Framework::Coordinator ecsInterface;
+
+/*  Allocation counting
+----------------------------------------------------------------------------- */
+static std::atomic<unsigned long long> allocationCount{ 0 };
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace Framework {
+
+    // Keeps results alive so the optimiser cannot drop the measured work
+    static volatile float benchmarkSink = 0.0f;
+
+    struct MicroBenchmarkCase
+    {
+        std::string name;
+        int size = 0;                                   // Input size the case was built with
+        std::function<void()> setup;                    // Runs once before timing
+        std::function<void(long long operations)> run;  // Performs exactly 'operations' ops
+    };
+
+    struct MicroBenchmarkResult
+    {
+        double nsPerOp = 0.0;
+        double allocationsPerOp = 0.0;
+        long long operations = 0;
+    };
+
+    // Doubles the operation count until one batch runs for at least minTimeMs
+    static MicroBenchmarkResult Measure(const MicroBenchmarkCase& benchmark, double minTimeMs)
+    {
+        MicroBenchmarkResult result;
+        long long operations = 1;
+
+        // Warm up caches and lazily created state
+        benchmark.run(operations);
+
+        while (true)
+        {
+            unsigned long long allocationsBefore = allocationCount.load();
+            auto start = std::chrono::high_resolution_clock::now();
+            benchmark.run(operations);
+            auto end = std::chrono::high_resolution_clock::now();
+            unsigned long long allocationsAfter = allocationCount.load();
+
+            double elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+            if (elapsedMs >= minTimeMs || operations >= (1LL << 40))
+            {
+                result.operations = operations;
+                result.nsPerOp = elapsedMs * 1.0e6 / operations;
+                result.allocationsPerOp = static_cast<double>(allocationsAfter - allocationsBefore) / operations;
+                return result;
+            }
+            operations *= 2;
+        }
+    }
+
+    // Creates 'count' entities with the components the graphics/animation paths expect
+    static std::vector<Entity> CreateBenchmarkEntities(int count, bool withTimeline)
+    {
+        ecsInterface.ClearEntities();
+        TagIndex::Clear();
+
+        std::mt19937 rng(42u);
+        std::uniform_int_distribution<int> layer(0, 4);
+        std::uniform_int_distribution<int> sort(0, 100);
+
+        std::vector<Entity> entities;
+        entities.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            Entity entity = ecsInterface.CreateEntity();
+
+            TransformComponent transform{};
+            transform.position = { static_cast<float>(i % 1920), static_cast<float>(i % 1080) };
+            transform.scale = { 64.0f, 64.0f };
+            ecsInterface.AddComponent<TransformComponent>(entity, transform);
+
+            LayerComponent layerComponent{};
+            layerComponent.layerID = layer(rng);
+            layerComponent.sortID = sort(rng);
+            ecsInterface.AddComponent<LayerComponent>(entity, layerComponent);
+
+            RenderComponent render{};
+            render.textureID = "PoisonIdleSprite";
+            ecsInterface.AddComponent<RenderComponent>(entity, render);
+
+            if (withTimeline)
+            {
+                TimelineComponent timeline{};
+                timeline.TransitionDuration = 1.0f;
+                timeline.startPosition = 0.0f;
+                timeline.endPosition = 800.0f;
+                timeline.IsTransitioningIn = true;
+                ecsInterface.AddComponent<TimelineComponent>(entity, timeline);
+            }
+            entities.push_back(entity);
+        }
+        return entities;
+    }
+
+    // Timer callback that waits its delay (the event, in milliseconds) again, keeping the wheel at a steady size
+    static void RescheduleBenchmarkTimer(Entity entity, std::uint32_t delayMs)
+    {
+        TimerWheel::Schedule(TimerClock::Interface, delayMs / 1000.0f, entity, RescheduleBenchmarkTimer, delayMs);
+    }
+
+    // Sequence waking up every period forever, for the scheduler case
+    static Sequence BenchmarkLoopSequence(Entity entity, float period)
+    {
+        (void)entity;
+        for (;;)
+        {
+            co_await Seconds(period, TimerClock::Interface);
+        }
+    }
+
+    static std::vector<MicroBenchmarkCase> BuildCases()
+    {
+        std::vector<MicroBenchmarkCase> cases;
+        static std::vector<Entity> entities;
+        static std::vector<Entity> scratch;
+        static std::vector<std::string> textureNames;
+
+        // --- Graphics::calculate2DTransform ---
+        cases.push_back({ "calculate2DTransform", 1, [] {}, [](long long ops)
+        {
+            glm::vec2 translation(100.0f, 200.0f);
+            glm::vec2 scale(64.0f, 64.0f);
+            for (long long i = 0; i < ops; ++i)
+            {
+                glm::mat4 m = Graphics::calculate2DTransform(translation, static_cast<float>(i & 255), scale);
+                benchmarkSink = benchmarkSink + m[3][0];
+            }
+        } });
+
+        // --- Layer sort comparator, full sort per op ---
+        for (int size : { 256, 4096, 65536 })
+        {
+            cases.push_back({ "Graphics::CompareRenderOrder sort", size,
+                [size] { entities = CreateBenchmarkEntities(size, false); },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        scratch.assign(entities.rbegin(), entities.rend());
+                        std::sort(scratch.begin(), scratch.end(), Graphics::CompareRenderOrder);
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(scratch.front());
+                } });
+        }
+
+        // --- Sorted render pass, components looked up per entity vs fetched once into view rows ---
+        using BenchmarkSpriteView = EntityView<With<TransformComponent, RenderComponent, LayerComponent>>;
+        for (int size : { 4096, 65536 })
+        {
+            cases.push_back({ "Render pass, GetComponent per entity", size,
+                [size] { entities = CreateBenchmarkEntities(size, false); },
+                [](long long ops)
+                {
+                    float sum = 0.0f;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        scratch.assign(entities.begin(), entities.end());
+                        std::sort(scratch.begin(), scratch.end(), Graphics::CompareRenderOrder);
+                        for (Entity entity : scratch)
+                        {
+                            sum += ecsInterface.GetComponent<TransformComponent>(entity).position.x + ecsInterface.GetComponent<RenderComponent>(entity).alpha;
+                        }
+                    }
+                    benchmarkSink = benchmarkSink + sum;
+                } });
+
+            cases.push_back({ "Render pass, EntityView rows", size,
+                [size]
+                {
+                    entities = CreateBenchmarkEntities(size, false);
+                    BenchmarkSpriteView::Get(entities);
+                },
+                [](long long ops)
+                {
+                    BenchmarkSpriteView& sprites = BenchmarkSpriteView::Get(entities);
+                    float sum = 0.0f;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        sprites.Refresh();
+                        sprites.Sort([](const BenchmarkSpriteView::Row& a, const BenchmarkSpriteView::Row& b)
+                        {
+                            return Graphics::CompareRenderOrder(a.Get<LayerComponent>(), a.entity, b.Get<LayerComponent>(), b.entity);
+                        });
+                        for (auto [entity, transform, render, layer] : sprites)
+                        {
+                            sum += transform.position.x + render.alpha;
+                        }
+                    }
+                    benchmarkSink = benchmarkSink + sum;
+                } });
+        }
+
+        // --- AnimationPlayback::Advance, every animation per op ---
+        for (int size : { 1024, 65536 })
+        {
+            cases.push_back({ "AnimationPlayback::Advance", size,
+                [size]
+                {
+                    AnimationPlayback::Clear();
+                    for (int i = 0; i < size; ++i)
+                    {
+                        AnimationPlayback::Play(static_cast<Entity>(i), 12, 8.0f + static_cast<float>(i % 5),
+                            (i % 4 == 0) ? AnimationLoopMode::Once : AnimationLoopMode::Loop);
+                    }
+                },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        AnimationPlayback::Advance(1.0f / 60.0f);
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(AnimationPlayback::GetEvents().size());
+                } });
+        }
+
+        // --- Timeline easing behaviors, one entity per op ---
+        for (int size : { 16, 1024 })
+        {
+            cases.push_back({ "SlideInElastic", size,
+                [size] { entities = CreateBenchmarkEntities(size, true); },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        SlideInElastic(entities[static_cast<size_t>(i) % entities.size()], 0.5f);
+                    }
+                } });
+
+            cases.push_back({ "SlideInBounce", size,
+                [size] { entities = CreateBenchmarkEntities(size, true); },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        SlideInBounce(entities[static_cast<size_t>(i) % entities.size()], 0.5f);
+                    }
+                } });
+        }
+
+        // --- TweenEngine::Update, every tween per op (looping elastic slides, one per entity) ---
+        for (int size : { 1024, 16384 })
+        {
+            cases.push_back({ "TweenEngine::Update", size,
+                [size]
+                {
+                    static TweenPreset elasticLoop;
+                    TweenTrackSpec slide;
+                    slide.property = TweenProperty::PositionX;
+                    slide.from = TweenValue::Start();
+                    slide.to = TweenValue::End();
+                    slide.wave = TweenCurve::ElasticBump;
+                    slide.amplitude = 20.0f;
+                    elasticLoop.tracks = { slide };
+                    elasticLoop.loop = true;
+
+                    entities = CreateBenchmarkEntities(size, false);
+                    TweenEngine::Clear();
+                    for (Entity entity : entities)
+                    {
+                        TweenEngine::Play(entity, elasticLoop, { 1.0f, 0.0f, 800.0f });
+                    }
+                },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        TweenEngine::Update(1.0f / 60.0f);
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(TweenEngine::GetTrackCount());
+                } });
+        }
+
+        // --- TimerWheel::Advance, one frame per op with mostly dormant timers rescheduling themselves ---
+        for (int size : { 1024, 65536 })
+        {
+            cases.push_back({ "TimerWheel::Advance", size,
+                [size]
+                {
+                    TimerWheel::Clear();
+                    for (int i = 0; i < size; ++i)
+                    {
+                        // Event is the delay in milliseconds, 0.5 to 30 seconds
+                        std::uint32_t delayMs = 500u + static_cast<std::uint32_t>(i * 7919) % 29500u;
+                        RescheduleBenchmarkTimer(static_cast<Entity>(i), delayMs);
+                    }
+                },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        TimerWheel::Advance(1.0f / 60.0f);
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(TimerWheel::GetPendingCount());
+                } });
+        }
+
+        // --- Sequences resumed by the timer wheel, one frame per op ---
+        for (int size : { 1024, 16384 })
+        {
+            cases.push_back({ "SequenceScheduler resume", size,
+                [size]
+                {
+                    SequenceScheduler::Clear();
+                    TimerWheel::Clear();
+                    for (int i = 0; i < size; ++i)
+                    {
+                        SequenceScheduler::Start(BenchmarkLoopSequence(static_cast<Entity>(i), 0.25f + static_cast<float>(i % 16) * 0.125f));
+                    }
+                },
+                [](long long ops)
+                {
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        TimerWheel::Advance(1.0f / 60.0f);
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(SequenceScheduler::GetRunningCount());
+                } });
+        }
+
+        // --- ECS component access ---
+        for (int size : { 256, 16384 })
+        {
+            cases.push_back({ "ecsInterface.GetComponent<TransformComponent>", size,
+                [size] { entities = CreateBenchmarkEntities(size, false); },
+                [](long long ops)
+                {
+                    float sum = 0.0f;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        sum += ecsInterface.GetComponent<TransformComponent>(entities[static_cast<size_t>(i) % entities.size()]).position.x;
+                    }
+                    benchmarkSink = benchmarkSink + sum;
+                } });
+
+            cases.push_back({ "ecsInterface.HasComponent<AnimationComponent>", size,
+                [size] { entities = CreateBenchmarkEntities(size, false); },
+                [](long long ops)
+                {
+                    int hits = 0;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        hits += ecsInterface.HasComponent<AnimationComponent>(entities[static_cast<size_t>(i) % entities.size()]) ? 1 : 0;
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(hits);
+                } });
+
+            // Every other entity carries the tag, as Graphics::Update checks it on each one
+            cases.push_back({ "ecsInterface.HasTag", size,
+                [size]
+                {
+                    entities = CreateBenchmarkEntities(size, false);
+                    for (size_t i = 0; i < entities.size(); i += 2)
+                    {
+                        ecsInterface.AddTag(entities[i], "WinUI");
+                    }
+                },
+                [](long long ops)
+                {
+                    int hits = 0;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        hits += ecsInterface.HasTag(entities[static_cast<size_t>(i) % entities.size()], "WinUI") ? 1 : 0;
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(hits);
+                } });
+
+            cases.push_back({ "TagIndex::Has", size,
+                [size]
+                {
+                    entities = CreateBenchmarkEntities(size, false);
+                    TagId tag = TagIndex::Intern("WinUI");
+                    for (size_t i = 0; i < entities.size(); i += 2)
+                    {
+                        TagIndex::Add(entities[i], tag);
+                    }
+                },
+                [](long long ops)
+                {
+                    static const TagId tag = TagIndex::Intern("WinUI");
+                    int hits = 0;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        hits += TagIndex::Has(entities[static_cast<size_t>(i) % entities.size()], tag) ? 1 : 0;
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(hits);
+                } });
+        }
+
+        // --- Texture name lookups in Graphics::textures (find + operator[] as in Graphics::Update) ---
+        for (int size : { 32, 512 })
+        {
+            cases.push_back({ "Graphics::textures lookup", size,
+                [size]
+                {
+                    Graphics::textures.clear();
+                    textureNames.clear();
+                    for (int i = 0; i < size; ++i)
+                    {
+                        textureNames.push_back("BenchmarkTextureName_" + std::to_string(i));
+                        Graphics::textures[textureNames.back()] = static_cast<GLuint>(i + 1);
+                    }
+                },
+                [](long long ops)
+                {
+                    GLuint sum = 0;
+                    for (long long i = 0; i < ops; ++i)
+                    {
+                        const std::string& name = textureNames[static_cast<size_t>(i) % textureNames.size()];
+                        if (Graphics::textures.find(name) != Graphics::textures.end())
+                        {
+                            sum += Graphics::textures[name];
+                        }
+                    }
+                    benchmarkSink = benchmarkSink + static_cast<float>(sum);
+                } });
+        }
+
+        return cases;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Framework;
+
+    std::string filter;
+    double minTimeMs = 200.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--min-time-ms" && i + 1 < argc)
+        {
+            minTimeMs = std::atof(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+        }
+    }
+
+    // Components are registered directly, the kernels below never need a GL context
+    ecsInterface.Init();
+    ComponentTypes::RegisterAll();
+    engineState.SetPlay(true);
+
+    std::cout << std::left << std::setw(50) << "benchmark" << std::setw(10) << "size"
+        << std::right << std::setw(14) << "ns/op" << std::setw(14) << "allocs/op" << std::endl;
+
+    for (const MicroBenchmarkCase& benchmark : BuildCases())
+    {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        benchmark.setup();
+        MicroBenchmarkResult result = Measure(benchmark, minTimeMs);
+
+        std::cout << std::left << std::setw(50) << benchmark.name << std::setw(10) << benchmark.size
+            << std::right << std::fixed << std::setprecision(2)
+            << std::setw(14) << result.nsPerOp << std::setw(14) << result.allocationsPerOp << std::endl;
+    }
+
+    ecsInterface.ClearEntities();
+    TagIndex::Clear();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,474 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file StressSceneBenchmark.cpp
+///
+/// @brief Standalone benchmark executable. Generates synthetic scenes shaped
+///        like our levels (sprites, animated enemies, text popups, UI bars and
+///        timelines) at 1k / 10k / 100k entities, runs the real AnimationSystem,
+///        TimelineSystem and Graphics through the SystemScheduler for a fixed
+///        number of frames at a fixed timestep on a headless context, and
+///        compares the results against a checked-in baseline.
+///
+///        Usage:
+///          StressSceneBenchmark [--headless=egl|osmesa] [--frames N] [--warmup N]
+///                               [--scales 1000,10000,100000] [--out results.json]
+///                               [--baseline Benchmarks/StressSceneBaseline.json]
+///                               [--tolerance 0.15] [--update-baseline]
+///                               [--workers N]
+///
+///        Exit code is 1 when any scene regresses past the tolerance or has no
+///        entry in the baseline.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Coordinator.h"
+#include "ComponentList.h"
+#include "ComponentTypes.h"
+#include "EngineState.h"
+#include "Graphics.h"
+#include "GraphicsWindows.h"
+#include "GraphicsStats.h"
+#include "AnimationSystem.h"
+#include "TimelineSystem.h"
+#include "SystemScheduler.h"
+#include "TagIndex.h"
+#include "TimerWheel.h"
+#include "HeadlessBenchmark.h"
+#include "rapidjson/document.h"
+
+// The engine's main translation unit is not linked into this executable
+Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+    // Shapes of generated scenes
+    enum class StressSceneKind
+    {
+        Sprites,    // Static sprites only
+        Mixed,      // Sprites, animated enemies, text popups and UI bars
+        Timeline    // Mixed scene where most entities run a timeline
+    };
+
+    struct StressSceneResult
+    {
+        std::string name;
+        int entityCount = 0;
+        FrameTimeSummary frameTimes;
+        unsigned int drawCalls = 0;
+    };
+
+    // Fixed timestep used for every system update
+    static constexpr float fixedDeltaTime = 1.0f / 60.0f;
+
+    // Textures that exist in TextureAsset.json / AnimationAsset.json
+    static const char* spriteTextures[] = { "Bullet", "fire", "SlowUI", "textbox" };
+    static const char* animationTextures[] = { "McIdleSprite", "PoisonIdleSprite", "BossIdle", "SmokeIdle" };
+
+    static const char* SceneKindName(StressSceneKind kind)
+    {
+        switch (kind)
+        {
+        case StressSceneKind::Sprites:  return "sprites";
+        case StressSceneKind::Mixed:    return "mixed";
+        case StressSceneKind::Timeline: return "timeline";
+        }
+        return "unknown";
+    }
+
+    // Simple in-place slide used for generated timelines, same shape as SlideIn in TimelineBehavior.h
+    static void StressSlide(Entity entity, float timer)
+    {
+        auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
+        auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+
+        float progress = std::min(timer / timeline.TransitionDuration, 1.0f);
+        transform.position.x = timeline.startPosition + progress * (timeline.endPosition - timeline.startPosition);
+    }
+
+    static void StressFade(Entity entity, float timer)
+    {
+        auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
+        auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+
+        float progress = std::min(timer / timeline.TransitionDuration, 1.0f);
+        render.alpha = 1.0f - progress;
+    }
+
+    // Builds one synthetic scene. The seed is fixed so every run draws the same workload.
+    static void GenerateStressScene(StressSceneKind kind, int entityCount)
+    {
+        std::mt19937 rng(1234u + static_cast<unsigned int>(entityCount));
+        std::uniform_real_distribution<float> posX(0.0f, 1920.0f);
+        std::uniform_real_distribution<float> posY(0.0f, 1080.0f);
+        std::uniform_real_distribution<float> size(16.0f, 128.0f);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::uniform_int_distribution<int> pick(0, 3);
+
+        for (int i = 0; i < entityCount; ++i)
+        {
+            Entity entity = ecsInterface.CreateEntity();
+
+            TransformComponent transform{};
+            transform.position = { posX(rng), posY(rng) };
+            float s = size(rng);
+            transform.scale = { s, s };
+            ecsInterface.AddComponent<TransformComponent>(entity, transform);
+
+            LayerComponent layer{};
+            layer.layerID = 0;
+            layer.sortID = percent(rng);
+            ecsInterface.AddComponent<LayerComponent>(entity, layer);
+
+            RenderComponent render{};
+            render.textureID = spriteTextures[pick(rng)];
+            render.isActive = true;
+            render.alpha = 1.0f;
+
+            int roll = (kind == StressSceneKind::Sprites) ? 0 : percent(rng);
+
+            // Level mix: ~55% sprites, 25% animated, 12% text, 8% UI bars
+            if (roll >= 55 && roll < 80)
+            {
+                render.textureID = animationTextures[pick(rng)];
+                ecsInterface.AddComponent<RenderComponent>(entity, render);
+                // A real sheet's layout, the asset's own rows/cols replace it on the first update
+                AnimationComponent animation{};
+                animation.rows = 4;
+                animation.cols = 4;
+                animation.animationSpeed = 12.0f;
+                ecsInterface.AddComponent<AnimationComponent>(entity, animation);
+            }
+            else if (roll >= 80 && roll < 92)
+            {
+                render.alpha = 0.0f;
+                ecsInterface.AddComponent<RenderComponent>(entity, render);
+
+                TextComponent text{};
+                text.text = "Great!";
+                text.fontName = "Salmon";
+                text.fontSize = 1.0f;
+                ecsInterface.AddComponent<TextComponent>(entity, text);
+            }
+            else if (roll >= 92)
+            {
+                render.alpha = 0.0f;
+                ecsInterface.AddComponent<RenderComponent>(entity, render);
+
+                UIBarComponent bar{};
+                bar.backingTextureID = "HP Bar BG.png";
+                bar.fillTextureID = "HP_Fill.png";
+                bar.scale = { 256.0f, 256.0f };
+                bar.fillSize = { 170.0f, 15.0f };
+                bar.fillOffset = { -70.0f, 3.0f };
+                bar.FillPercentage = 0.5f;
+                bar.bgAlpha = 1.0f;
+                bar.fillAlpha = 1.0f;
+                ecsInterface.AddComponent<UIBarComponent>(entity, bar);
+            }
+            else
+            {
+                ecsInterface.AddComponent<RenderComponent>(entity, render);
+            }
+
+            // Timeline scenes put a timeline on ~80% of entities, mixed scenes on ~10%
+            int timelineChance = (kind == StressSceneKind::Timeline) ? 80 : (kind == StressSceneKind::Mixed ? 10 : 0);
+            if (percent(rng) < timelineChance)
+            {
+                TimelineComponent timeline{};
+                timeline.TimelineTag = "Stress";
+                timeline.Active = true;
+                timeline.IsTransitioningIn = true;
+                timeline.TransitionDuration = 2.0f;
+                timeline.TransitionInDelay = 0.1f * pick(rng);
+                timeline.TransitionOutDelay = 0.5f;
+                timeline.startPosition = transform.position.x;
+                timeline.endPosition = transform.position.x + 200.0f;
+                timeline.TransitionIn = StressSlide;
+                timeline.TransitionOut = StressFade;
+                ecsInterface.AddComponent<TimelineComponent>(entity, timeline);
+            }
+        }
+    }
+
+    static StressSceneResult RunStressScene(StressSceneKind kind, int entityCount, int frames, int warmupFrames)
+    {
+        StressSceneResult result;
+        result.name = std::string(SceneKindName(kind)) + "_" + std::to_string(entityCount);
+        result.entityCount = entityCount;
+
+        ecsInterface.ClearEntities();
+        TimerWheel::Clear(); // Delays of the previous scene would put reused entity ids to sleep
+        TagIndex::Clear();
+        GenerateStressScene(kind, entityCount);
+
+        engineState.SetPlay(true);
+        engineState.SetPaused(false);
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(frames);
+
+        for (int frame = 0; frame < warmupFrames + frames; ++frame)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            SystemScheduler::Run(fixedDeltaTime);
+            glFinish();
+
+            auto end = std::chrono::high_resolution_clock::now();
+            if (frame >= warmupFrames)
+            {
+                frameTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            }
+        }
+
+        result.frameTimes = HeadlessBenchmark::Summarize(frameTimes);
+        result.drawCalls = GraphicsStats::GetLastFrameCount(GLCallCategory::DrawCall);
+
+        std::cout << result.name << ": mean " << result.frameTimes.mean << " ms, p95 " << result.frameTimes.p95
+            << " ms, p99 " << result.frameTimes.p99 << " ms, " << result.drawCalls << " draws" << std::endl;
+        return result;
+    }
+
+    static void WriteStressResults(const std::string& path, const std::vector<StressSceneResult>& results, int frames)
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cerr << "Failed to open benchmark output: " << path << std::endl;
+            return;
+        }
+
+        file << "{\n";
+        file << "  \"frames\": " << frames << ",\n";
+        file << "  \"timestep\": " << fixedDeltaTime << ",\n";
+        file << "  \"scenes\": [\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const StressSceneResult& r = results[i];
+            file << "    { \"name\": \"" << r.name << "\", \"entities\": " << r.entityCount
+                << ", \"mean_ms\": " << r.frameTimes.mean
+                << ", \"p50_ms\": " << r.frameTimes.p50
+                << ", \"p95_ms\": " << r.frameTimes.p95
+                << ", \"p99_ms\": " << r.frameTimes.p99
+                << ", \"max_ms\": " << r.frameTimes.max
+                << ", \"draw_calls\": " << r.drawCalls << " }"
+                << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n";
+        file << "}\n";
+    }
+
+    // Reads a numeric field of a scene object written by WriteStressResults
+    static bool ReadBaselineValue(const rapidjson::Value& scene, const char* key, double& value)
+    {
+        if (!scene.HasMember(key) || !scene[key].IsNumber())
+        {
+            return false;
+        }
+        value = scene[key].GetDouble();
+        return true;
+    }
+
+    // The baseline's scene object with this name, nullptr if there is none
+    static const rapidjson::Value* FindBaselineScene(const rapidjson::Document& baseline, const std::string& sceneName)
+    {
+        if (!baseline.HasMember("scenes") || !baseline["scenes"].IsArray())
+        {
+            return nullptr;
+        }
+        for (const rapidjson::Value& scene : baseline["scenes"].GetArray())
+        {
+            if (scene.IsObject() && scene.HasMember("name") && scene["name"].IsString() && sceneName == scene["name"].GetString())
+            {
+                return &scene;
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns the number of scenes that regressed against the baseline or have no baseline to compare with
+    static int CompareAgainstBaseline(const std::string& path, const std::vector<StressSceneResult>& results, double tolerance)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            // A gate without a baseline would pass anything
+            std::cerr << "No baseline at " << path << ", run with --update-baseline on the reference machine." << std::endl;
+            return static_cast<int>(results.size());
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string contents = buffer.str();
+
+        rapidjson::Document baseline;
+        baseline.Parse(contents.c_str(), contents.size());
+        if (baseline.HasParseError() || !baseline.IsObject())
+        {
+            std::cerr << path << " is not valid JSON, run with --update-baseline on the reference machine." << std::endl;
+            return static_cast<int>(results.size());
+        }
+
+        int regressions = 0;
+        for (const StressSceneResult& r : results)
+        {
+            double baseMean = 0.0, baseP95 = 0.0, baseDraws = 0.0;
+            const rapidjson::Value* scene = FindBaselineScene(baseline, r.name);
+            if (!scene ||
+                !ReadBaselineValue(*scene, "mean_ms", baseMean) ||
+                !ReadBaselineValue(*scene, "p95_ms", baseP95) ||
+                !ReadBaselineValue(*scene, "draw_calls", baseDraws))
+            {
+                std::cerr << "MISSING " << r.name << ": not in baseline, run with --update-baseline on the reference machine" << std::endl;
+                ++regressions;
+                continue;
+            }
+
+            bool meanRegressed = r.frameTimes.mean > baseMean * (1.0 + tolerance);
+            bool p95Regressed = r.frameTimes.p95 > baseP95 * (1.0 + tolerance);
+            bool drawsRegressed = r.drawCalls > static_cast<unsigned int>(baseDraws);
+
+            if (meanRegressed || p95Regressed || drawsRegressed)
+            {
+                ++regressions;
+                std::cerr << "REGRESSION " << r.name
+                    << ": mean " << r.frameTimes.mean << " ms (baseline " << baseMean << ")"
+                    << ", p95 " << r.frameTimes.p95 << " ms (baseline " << baseP95 << ")"
+                    << ", draws " << r.drawCalls << " (baseline " << baseDraws << ")" << std::endl;
+            }
+        }
+        return regressions;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Framework;
+
+    int frames = 300;
+    int warmupFrames = 30;
+    double tolerance = 0.15;
+    bool updateBaseline = false;
+    int workers = 0;
+    std::string outputPath = "StressSceneResults.json";
+    std::string baselinePath = "Benchmarks/StressSceneBaseline.json";
+    std::vector<int> scales = { 1000, 10000, 100000 };
+
+    // Context selection is shared with the engine's headless mode
+    HeadlessBenchmark::settings.enabled = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--headless=osmesa")
+        {
+            HeadlessBenchmark::settings.context = HeadlessContext::OSMesa;
+        }
+        else if (arg == "--headless" || arg == "--headless=egl")
+        {
+            HeadlessBenchmark::settings.context = HeadlessContext::EGL;
+        }
+        else if (arg == "--frames" && hasValue)
+        {
+            frames = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--warmup" && hasValue)
+        {
+            warmupFrames = std::max(0, std::atoi(argv[++i]));
+        }
+        else if (arg == "--tolerance" && hasValue)
+        {
+            tolerance = std::atof(argv[++i]);
+        }
+        else if (arg == "--out" && hasValue)
+        {
+            outputPath = argv[++i];
+        }
+        else if (arg == "--baseline" && hasValue)
+        {
+            baselinePath = argv[++i];
+        }
+        else if (arg == "--update-baseline")
+        {
+            updateBaseline = true;
+        }
+        else if (arg == "--workers" && hasValue)
+        {
+            workers = std::max(0, std::atoi(argv[++i]));
+        }
+        else if (arg == "--scales" && hasValue)
+        {
+            scales.clear();
+            std::stringstream ss(argv[++i]);
+            std::string scale;
+            while (std::getline(ss, scale, ','))
+            {
+                scales.push_back(std::atoi(scale.c_str()));
+            }
+        }
+        else
+        {
+            std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+        }
+    }
+
+    ecsInterface.Init();
+    ComponentTypes::RegisterAll();
+
+    Window::WindowConfig config{};
+    config.x = 1920;
+    config.y = 1080;
+    config.programName = "StressSceneBenchmark";
+
+    // No CoreEngine here, the benchmark drives the frames itself
+    GraphicsWindows windows(config, nullptr);
+    auto graphics = ecsInterface.RegisterSystem<Graphics>(&windows);
+    auto animationSystem = ecsInterface.RegisterSystem<AnimationSystem>();
+    auto timelineSystem = ecsInterface.RegisterSystem<TimelineSystem>();
+
+    // Systems add themselves to the scheduler as they initialize, so this is the engine's frame order;
+    // the scheduler runs whatever does not conflict side by side
+    SystemScheduler::SetWorkerCount(static_cast<unsigned>(workers));
+    animationSystem->Initialize();
+    timelineSystem->Initialize();
+    graphics->Initialize();
+
+    std::vector<StressSceneResult> results;
+    for (int scale : scales)
+    {
+        for (StressSceneKind kind : { StressSceneKind::Sprites, StressSceneKind::Mixed, StressSceneKind::Timeline })
+        {
+            results.push_back(RunStressScene(kind, scale, frames, warmupFrames));
+        }
+    }
+    ecsInterface.ClearEntities();
+    SystemScheduler::Clear();
+
+    WriteStressResults(outputPath, results, frames);
+
+    if (updateBaseline)
+    {
+        WriteStressResults(baselinePath, results, frames);
+        std::cout << "Baseline updated: " << baselinePath << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int regressions = CompareAgainstBaseline(baselinePath, results, tolerance);
+    std::cout << regressions << " regression(s) or missing scene(s) against " << baselinePath << std::endl;
+    return regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file ComponentTypes.cpp
+///
+/// @brief Bookkeeping of the components registered through ComponentTypes
+///        and the check of their Coordinator ids.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "ComponentTypes.h"
+#include <iostream>
+
+namespace Framework {
+
+	Signature ComponentTypes::registered{};
+
+	bool ComponentTypes::Claim(std::size_t component)
+	{
+		if (registered.test(component))
+		{
+			return false;
+		}
+		registered.set(component);
+		return true;
+	}
+
+	void ComponentTypes::Verify(std::size_t component, std::size_t coordinatorId)
+	{
+		if (coordinatorId != component)
+		{
+			// Registered in a different order than EngineComponents lists it; reported rather than fatal, as the
+			// order also depends on the engine's startup
+			std::cerr << "ComponentTypes: component " << component << " of EngineComponents has Coordinator id "
+				<< coordinatorId << ", signatures testing it are wrong" << std::endl;
+		}
+	}
+}
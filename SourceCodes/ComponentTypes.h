@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file ComponentTypes.h
+///
+/// @brief Component type ids fixed at compile time. EngineComponents lists
+///        every component in the order it is registered, so a component's id
+///        is its position in the list:
+///
+///          ComponentId<RenderComponent>                         // 6
+///          SignatureOf<TransformComponent, RenderComponent>     // bits 5 and 6
+///
+///        Both are constants, so a system signature or a signature test costs
+///        no lookup, and naming a type that is not an engine component does
+///        not compile. The Coordinator still numbers components as they are
+///        registered, by the systems and the engine's startup in the order
+///        the list follows; ComponentTypes::Register registers a system's
+///        components and checks the Coordinator gave them these ids.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _COMPONENT_TYPES_H_
+#define _COMPONENT_TYPES_H_
+
+#include <cstddef>
+#include <type_traits>
+#include "ComponentList.h"
+#include "Coordinator.h"
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+	template <typename... Types>
+	struct TypeList {};
+
+	// Registration order, which is also the order of the editor's component panels. New components go at the end
+	using EngineComponents = TypeList<
+		MovementComponent,
+		EnemyComponent,
+		CollisionComponent,
+		AnimationComponent,
+		BulletComponent,
+		TransformComponent,
+		RenderComponent,
+		LayerComponent,
+		TextComponent,
+		PlayerComponent,
+		ButtonComponent,
+		TimelineComponent,
+		ParticleComponent,
+		SpawnerComponent,
+		UIBarComponent>;
+
+	template <typename... Types>
+	constexpr std::size_t CountOf(TypeList<Types...>)
+	{
+		return sizeof...(Types);
+	}
+
+	// Position of T in the list, the list's size if it is not there
+	template <typename T, typename... Types>
+	constexpr std::size_t IndexOf(TypeList<Types...>)
+	{
+		std::size_t index = 0;
+		bool found = false;
+		((found = found || std::is_same_v<T, Types>, index += found ? 0 : 1), ...);
+		return index;
+	}
+
+	inline constexpr std::size_t ComponentCount = CountOf(EngineComponents{});
+	static_assert(ComponentCount <= Signature().size(), "ComponentTypes: more engine components than Signature bits");
+	static_assert(ComponentCount <= 64, "ComponentTypes: SignatureOf builds signatures from a 64-bit mask");
+
+	template <typename T>
+	struct ComponentIdOf
+	{
+		static constexpr std::size_t value = IndexOf<std::remove_cv_t<T>>(EngineComponents{});
+		static_assert(value < ComponentCount, "ComponentTypes: not an engine component, add it to EngineComponents");
+	};
+
+	template <typename T>
+	inline constexpr std::size_t ComponentId = ComponentIdOf<T>::value;
+
+	// Signature with the bits of the given components set
+	template <typename... Types>
+	inline constexpr Signature SignatureOf = Signature((0ull | ... | (1ull << ComponentId<Types>)));
+
+	class ComponentTypes
+	{
+	public:
+		/**
+		 * @brief Registers the given components with the Coordinator, skipping those already registered
+		 *        through here, then checks their Coordinator ids against EngineComponents. Each system calls
+		 *        it in Initialize for the components it owns; the others come from the engine's startup.
+		 */
+		template <typename... Types>
+		static void Register()
+		{
+			((Claim(ComponentId<Types>) ? ecsInterface.RegisterComponent<Types>() : void()), ...);
+			(Verify(ComponentId<Types>, static_cast<std::size_t>(ecsInterface.GetComponentType<Types>())), ...);
+		}
+
+		// Every engine component in list order, for executables without the engine's startup (the benchmarks)
+		static void RegisterAll()
+		{
+			RegisterList(EngineComponents{});
+		}
+
+	private:
+		template <typename... Types>
+		static void RegisterList(TypeList<Types...>)
+		{
+			Register<Types...>();
+		}
+
+		// True the first time a component is registered through here
+		static bool Claim(std::size_t component);
+
+		// Reports a Coordinator id that differs from the compile-time one, signatures would test the wrong bit
+		static void Verify(std::size_t component, std::size_t coordinatorId);
+
+		static Signature registered;
+	};
+}
+#endif // !_COMPONENT_TYPES_H_
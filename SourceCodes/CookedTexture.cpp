@@ -0,0 +1,249 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file CookedTexture.cpp
+///
+/// @brief Cooked texture writing (mip generation, premultiplication) and
+///        in-place reading from the asset archive or a mapped loose file.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "CookedTexture.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Framework {
+
+	static std::size_t AlignUp(std::size_t value, std::size_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	std::uint64_t CookedTexture::HashBytes(const void* data, std::size_t size)
+	{
+		const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+		std::uint64_t hash = 14695981039346656037ull;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	std::string CookedTexture::CookedPathFor(const std::string& sourcePath)
+	{
+		std::string relative = sourcePath;
+		const std::string assetsPrefix = "Assets/";
+		if (relative.compare(0, assetsPrefix.size(), assetsPrefix) == 0)
+		{
+			relative = relative.substr(assetsPrefix.size());
+		}
+
+		std::size_t extension = relative.find_last_of('.');
+		std::size_t separator = relative.find_last_of("/\\");
+		if (extension != std::string::npos && (separator == std::string::npos || extension > separator))
+		{
+			relative = relative.substr(0, extension);
+		}
+		return assetsPrefix + "Cooked/" + relative + ".ctex";
+	}
+
+	bool CookedTexture::Write(const std::string& path, const std::uint8_t* pixels, std::uint32_t width, std::uint32_t height,
+		bool premultiply, std::uint64_t sourceHash)
+	{
+		// Level 0, premultiplied so the box filter below weights colour by coverage
+		std::vector<std::vector<std::uint8_t>> levels(1, std::vector<std::uint8_t>(pixels, pixels + static_cast<std::size_t>(width) * height * 4));
+		for (std::size_t i = 0; i < levels[0].size(); i += 4)
+		{
+			std::uint32_t alpha = levels[0][i + 3];
+			for (std::size_t c = 0; c < 3; ++c)
+			{
+				levels[0][i + c] = static_cast<std::uint8_t>((levels[0][i + c] * alpha + 127) / 255);
+			}
+		}
+
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> sizes{ { width, height } };
+		while (sizes.back().first > 1 || sizes.back().second > 1)
+		{
+			std::uint32_t srcWidth = sizes.back().first;
+			std::uint32_t srcHeight = sizes.back().second;
+			std::uint32_t dstWidth = std::max(1u, srcWidth / 2);
+			std::uint32_t dstHeight = std::max(1u, srcHeight / 2);
+			const std::vector<std::uint8_t>& src = levels.back();
+			std::vector<std::uint8_t> dst(static_cast<std::size_t>(dstWidth) * dstHeight * 4);
+
+			for (std::uint32_t y = 0; y < dstHeight; ++y)
+			{
+				for (std::uint32_t x = 0; x < dstWidth; ++x)
+				{
+					// 2x2 box, edges of odd sizes reuse the last row / column
+					std::uint32_t x0 = std::min(x * 2, srcWidth - 1), x1 = std::min(x * 2 + 1, srcWidth - 1);
+					std::uint32_t y0 = std::min(y * 2, srcHeight - 1), y1 = std::min(y * 2 + 1, srcHeight - 1);
+					for (std::size_t c = 0; c < 4; ++c)
+					{
+						std::uint32_t sum = src[(static_cast<std::size_t>(y0) * srcWidth + x0) * 4 + c]
+							+ src[(static_cast<std::size_t>(y0) * srcWidth + x1) * 4 + c]
+							+ src[(static_cast<std::size_t>(y1) * srcWidth + x0) * 4 + c]
+							+ src[(static_cast<std::size_t>(y1) * srcWidth + x1) * 4 + c];
+						dst[(static_cast<std::size_t>(y) * dstWidth + x) * 4 + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+					}
+				}
+			}
+			levels.push_back(std::move(dst));
+			sizes.emplace_back(dstWidth, dstHeight);
+		}
+
+		// Back to straight alpha when the texture is not shipped premultiplied
+		if (!premultiply)
+		{
+			for (std::vector<std::uint8_t>& level : levels)
+			{
+				for (std::size_t i = 0; i < level.size(); i += 4)
+				{
+					std::uint32_t alpha = level[i + 3];
+					for (std::size_t c = 0; c < 3; ++c)
+					{
+						level[i + c] = alpha == 0 ? 0 : static_cast<std::uint8_t>(std::min(255u, (level[i + c] * 255u + alpha / 2) / alpha));
+					}
+				}
+			}
+		}
+
+		CookedTextureHeader header{};
+		header.magic = FileMagic;
+		header.version = FileVersion;
+		header.width = width;
+		header.height = height;
+		header.mipCount = static_cast<std::uint32_t>(levels.size());
+		header.format = CookedTextureFormat::RGBA8;
+		header.flags = premultiply ? CookedTexturePremultiplied : 0u;
+		header.sourceHash = sourceHash;
+
+		std::vector<CookedMipEntry> entries(levels.size());
+		std::size_t offset = AlignUp(sizeof(CookedTextureHeader) + sizeof(CookedMipEntry) * entries.size(), DataAlignment);
+		for (std::size_t level = 0; level < levels.size(); ++level)
+		{
+			entries[level] = { offset, levels[level].size(), sizes[level].first, sizes[level].second };
+			offset = AlignUp(offset + levels[level].size(), DataAlignment);
+		}
+
+		std::ofstream output(path, std::ios::binary | std::ios::trunc);
+		if (!output)
+		{
+			return false;
+		}
+		output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		output.write(reinterpret_cast<const char*>(entries.data()), sizeof(CookedMipEntry) * entries.size());
+		for (std::size_t level = 0; level < levels.size(); ++level)
+		{
+			std::streamoff padding = static_cast<std::streamoff>(entries[level].offset) - output.tellp();
+			for (std::streamoff i = 0; i < padding; ++i)
+			{
+				output.put('\0');
+			}
+			output.write(reinterpret_cast<const char*>(levels[level].data()), static_cast<std::streamsize>(levels[level].size()));
+		}
+		return static_cast<bool>(output);
+	}
+
+	bool CookedTexture::ReadHeader(const std::string& path, CookedTextureHeader& header)
+	{
+		std::ifstream input(path, std::ios::binary);
+		if (!input.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		{
+			return false;
+		}
+		return header.magic == FileMagic && header.version == FileVersion;
+	}
+
+	// The largest chain Write produces for the size: halving down to 1x1
+	static std::uint32_t MaxMipCount(std::uint32_t width, std::uint32_t height)
+	{
+		std::uint32_t levels = 1;
+		for (std::uint32_t size = std::max(width, height); size > 1; size /= 2)
+		{
+			++levels;
+		}
+		return levels;
+	}
+
+	// Packed sources ship with their cooked files, only a loose source can have been edited since cooking
+	static bool IsStale(const std::string& cookedPath, const CookedTextureHeader& header, const std::string& sourcePath)
+	{
+		if (sourcePath.empty() || AssetArchive::Find(sourcePath))
+		{
+			return false;
+		}
+
+		std::error_code error;
+		std::filesystem::file_time_type sourceTime = std::filesystem::last_write_time(sourcePath, error);
+		if (error)
+		{
+			return false; // No source to fall back to
+		}
+		if (!AssetArchive::Find(cookedPath))
+		{
+			std::filesystem::file_time_type cookedTime = std::filesystem::last_write_time(cookedPath, error);
+			if (!error && sourceTime <= cookedTime)
+			{
+				return false;
+			}
+		}
+
+		// A checkout touches files without changing them, so the content decides
+		AssetData source;
+		if (!AssetArchive::Open(sourcePath, source))
+		{
+			return false;
+		}
+		return CookedTexture::HashBytes(source.Data(), source.Size()) != header.sourceHash;
+	}
+
+	bool CookedTexture::Open(const std::string& path, const std::string& sourcePath)
+	{
+		header = nullptr;
+		mips = nullptr;
+		if (!AssetArchive::Open(path, asset) || asset.Size() < sizeof(CookedTextureHeader))
+		{
+			return false;
+		}
+
+		const CookedTextureHeader* candidate = reinterpret_cast<const CookedTextureHeader*>(asset.Data());
+		if (candidate->magic != FileMagic || candidate->version != FileVersion || candidate->format != CookedTextureFormat::RGBA8
+			|| candidate->width == 0 || candidate->height == 0
+			|| candidate->mipCount == 0 || candidate->mipCount > MaxMipCount(candidate->width, candidate->height)
+			|| asset.Size() < sizeof(CookedTextureHeader) + sizeof(CookedMipEntry) * candidate->mipCount)
+		{
+			return false;
+		}
+
+		const CookedMipEntry* table = reinterpret_cast<const CookedMipEntry*>(asset.Data() + sizeof(CookedTextureHeader));
+		if (table[0].width != candidate->width || table[0].height != candidate->height)
+		{
+			return false;
+		}
+		for (std::uint32_t level = 0; level < candidate->mipCount; ++level)
+		{
+			if (table[level].offset > asset.Size() || table[level].size > asset.Size() - table[level].offset
+				|| table[level].size != static_cast<std::uint64_t>(table[level].width) * table[level].height * 4)
+			{
+				return false;
+			}
+		}
+
+		if (IsStale(path, *candidate, sourcePath))
+		{
+			return false;
+		}
+
+		header = candidate;
+		mips = table;
+		return true;
+	}
+}
@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file CookedTexture.h
+///
+/// @brief GPU-ready texture format written by the AssetCooker tool. A cooked
+///        file holds a small header, a mip table and every level of the mip
+///        chain as raw RGBA8 (optionally premultiplied), so loading is a memory
+///        map and one upload per level with no image decode.
+///
+///        Layout:
+///          CookedTextureHeader
+///          CookedMipEntry[mipCount]
+///          level data, each level aligned to CookedTexture::DataAlignment
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _COOKED_TEXTURE_H_
+#define _COOKED_TEXTURE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "AssetArchive.h"
+
+namespace Framework {
+
+	enum class CookedTextureFormat : std::uint32_t
+	{
+		RGBA8 = 0
+	};
+
+	enum CookedTextureFlags : std::uint32_t
+	{
+		CookedTexturePremultiplied = 1u << 0
+	};
+
+	struct CookedTextureHeader
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint32_t width;
+		std::uint32_t height;
+		std::uint32_t mipCount;
+		CookedTextureFormat format;
+		std::uint32_t flags;
+		std::uint32_t reserved;
+		std::uint64_t sourceHash;       // Hash of the source image file, re-cook when it changes
+	};
+
+	struct CookedMipEntry
+	{
+		std::uint64_t offset;           // From the start of the file
+		std::uint64_t size;
+		std::uint32_t width;
+		std::uint32_t height;
+	};
+
+	class CookedTexture
+	{
+	public:
+		static constexpr std::uint32_t FileMagic = 0x58544355; // "UCTX"
+		static constexpr std::uint32_t FileVersion = 1;
+		static constexpr std::size_t DataAlignment = 16;
+
+		/**
+		 * @brief 64-bit FNV-1a hash of a byte range, used to key cooked files by source content.
+		 */
+		static std::uint64_t HashBytes(const void* data, std::size_t size);
+
+		/**
+		 * @brief Where the cooked file of a source image lives.
+		 *        "Assets/Images/Logo.png" cooks to "Assets/Cooked/Images/Logo.ctex".
+		 */
+		static std::string CookedPathFor(const std::string& sourcePath);
+
+		/**
+		 * @brief Builds the mip chain of an RGBA8 image and writes the cooked file.
+		 *        Mips are box filtered on premultiplied colour so transparent texels do not darken edges.
+		 *
+		 * @param pixels : width * height RGBA8 texels, first row at the top of the image
+		 * @param premultiply : store colour premultiplied by alpha
+		 *
+		 * @return false if the file could not be written.
+		 */
+		static bool Write(const std::string& path, const std::uint8_t* pixels, std::uint32_t width, std::uint32_t height,
+			bool premultiply, std::uint64_t sourceHash);
+
+		/**
+		 * @brief Reads only the header of a cooked file, e.g. to check its source hash.
+		 *
+		 * @return false if the file is missing or not a cooked texture of this version.
+		 */
+		static bool ReadHeader(const std::string& path, CookedTextureHeader& header);
+
+		/**
+		 * @brief Opens a cooked file from the asset archive or as a mapped loose file,
+		 *        and validates its header and mip table.
+		 *
+		 * @param sourcePath : image the file was cooked from. A loose source newer than the cooked file
+		 *                     is hashed, and a hash other than the stored one rejects the cooked file so
+		 *                     the caller loads the edited source instead.
+		 */
+		bool Open(const std::string& path, const std::string& sourcePath = {});
+
+		const CookedTextureHeader& Header() const { return *header; }
+		const CookedMipEntry& Mip(std::uint32_t level) const { return mips[level]; }
+		const std::uint8_t* MipData(std::uint32_t level) const { return asset.Data() + mips[level].offset; }
+		bool IsPremultiplied() const { return (header->flags & CookedTexturePremultiplied) != 0; }
+
+	private:
+		AssetData asset;
+		const CookedTextureHeader* header = nullptr;
+		const CookedMipEntry* mips = nullptr;
+	};
+}
+#endif // !_COOKED_TEXTURE_H_
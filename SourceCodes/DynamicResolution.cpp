@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file DynamicResolution.cpp
+///
+/// @brief GPU-time driven resolution scale for the scene pass. Timings come
+///        from GL_TIME_ELAPSED queries that are read back only once available,
+///        so the controller never stalls the pipeline.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "DynamicResolution.h"
+#include <algorithm>
+#include <cmath>
+#include "Graphics.h"
+#include "GraphicsStats.h"
+#include "RenderTargetPool.h"
+#include "imgui.h"
+
+namespace Framework {
+
+	DynamicResolutionSettings DynamicResolution::settings{};
+	RenderTarget* DynamicResolution::sceneTarget{};
+	int DynamicResolution::outputWidth{}, DynamicResolution::outputHeight{};
+	int DynamicResolution::scaledWidth{}, DynamicResolution::scaledHeight{};
+	float DynamicResolution::scale = 1.0f;
+	bool DynamicResolution::locked{};
+	double DynamicResolution::smoothedGpuMs{};
+	int DynamicResolution::framesSinceChange{};
+	std::array<GLuint, DynamicResolution::TimerSlots> DynamicResolution::timerQueries{};
+	std::array<bool, DynamicResolution::TimerSlots> DynamicResolution::timerPending{};
+	std::size_t DynamicResolution::timerSlot{};
+	bool DynamicResolution::timerActive{};
+
+	void DynamicResolution::Initialize(int width, int height)
+	{
+		outputWidth = width;
+		outputHeight = height;
+
+		glGenQueries(static_cast<GLsizei>(TimerSlots), timerQueries.data());
+	}
+
+	void DynamicResolution::BeginScene(GLuint outputFramebuffer)
+	{
+		PollTimers();
+
+		scaledWidth = std::max(1, static_cast<int>(std::lround(outputWidth * scale)));
+		scaledHeight = std::max(1, static_cast<int>(std::lround(outputHeight * scale)));
+
+		// Native scale renders straight into the output, no blit needed. Lower scales borrow a
+		// native size target and only use its lower-left region, so scale changes never reallocate
+		if (scaledWidth != outputWidth || scaledHeight != outputHeight)
+		{
+			sceneTarget = RenderTargetPool::Acquire({ outputWidth, outputHeight, GL_RGB8, true });
+		}
+		glBindFramebuffer(GL_FRAMEBUFFER, sceneTarget != nullptr ? sceneTarget->framebuffer : outputFramebuffer);
+		GraphicsStats::Count(GLCallCategory::FramebufferBind);
+		glViewport(0, 0, sceneTarget != nullptr ? scaledWidth : outputWidth, sceneTarget != nullptr ? scaledHeight : outputHeight);
+
+		timerActive = !timerPending[timerSlot] && timerQueries[timerSlot] != 0;
+		if (timerActive)
+		{
+			glBeginQuery(GL_TIME_ELAPSED, timerQueries[timerSlot]);
+		}
+	}
+
+	void DynamicResolution::EndScene(GLuint outputFramebuffer)
+	{
+		if (timerActive)
+		{
+			glEndQuery(GL_TIME_ELAPSED);
+			timerPending[timerSlot] = true;
+			timerSlot = (timerSlot + 1) % TimerSlots;
+			timerActive = false;
+		}
+
+		if (sceneTarget != nullptr)
+		{
+			// Bilinear upscale of the rendered region to the full output
+			glBlitNamedFramebuffer(sceneTarget->framebuffer, outputFramebuffer,
+				0, 0, scaledWidth, scaledHeight,
+				0, 0, outputWidth, outputHeight,
+				GL_COLOR_BUFFER_BIT, GL_LINEAR);
+			glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+			GraphicsStats::Count(GLCallCategory::FramebufferBind);
+
+			RenderTargetPool::Release(sceneTarget);
+			sceneTarget = nullptr;
+		}
+		glViewport(0, 0, outputWidth, outputHeight);
+	}
+
+	void DynamicResolution::Lock(float lockedScale)
+	{
+		scale = std::clamp(lockedScale, 0.1f, 1.0f);
+		locked = true;
+	}
+
+	void DynamicResolution::Unlock()
+	{
+		locked = false;
+		framesSinceChange = 0;
+	}
+
+	void DynamicResolution::PollTimers()
+	{
+		for (std::size_t i = 0; i < TimerSlots; ++i)
+		{
+			// Oldest first
+			std::size_t slot = (timerSlot + i) % TimerSlots;
+			if (!timerPending[slot])
+			{
+				continue;
+			}
+
+			GLint available = GL_FALSE;
+			glGetQueryObjectiv(timerQueries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+			{
+				continue;
+			}
+
+			GLuint64 elapsedNs = 0;
+			glGetQueryObjectui64v(timerQueries[slot], GL_QUERY_RESULT, &elapsedNs);
+			timerPending[slot] = false;
+			Adjust(static_cast<double>(elapsedNs) / 1.0e6);
+		}
+	}
+
+	void DynamicResolution::Adjust(double gpuMs)
+	{
+		smoothedGpuMs = (smoothedGpuMs == 0.0) ? gpuMs : smoothedGpuMs * 0.9 + gpuMs * 0.1;
+
+		++framesSinceChange;
+		if (locked || framesSinceChange < settings.cooldownFrames)
+		{
+			return;
+		}
+
+		// Step down when over budget, step up only with clear headroom so the scale does not oscillate
+		float newScale = scale;
+		if (smoothedGpuMs > settings.targetGpuMs)
+		{
+			newScale = scale - settings.scaleStep;
+		}
+		else if (smoothedGpuMs < settings.targetGpuMs * 0.7)
+		{
+			newScale = scale + settings.scaleStep;
+		}
+		newScale = std::clamp(newScale, settings.minScale, std::min(settings.maxScale, 1.0f));
+
+		if (newScale != scale)
+		{
+			scale = newScale;
+			framesSinceChange = 0;
+			Graphics::MarkSceneDirty();
+		}
+	}
+
+	void DynamicResolution::ShowImGui()
+	{
+		if (ImGui::CollapsingHeader("Dynamic Resolution", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			ImGui::Text("Scale: %.0f%% (%d x %d)", scale * 100.0f, scaledWidth, scaledHeight);
+			ImGui::Text("Scene GPU time: %.2f ms (target %.2f ms)", smoothedGpuMs, settings.targetGpuMs);
+
+			bool lockScale = locked;
+			if (ImGui::Checkbox("Lock scale", &lockScale))
+			{
+				if (lockScale)
+				{
+					Lock(scale);
+				}
+				else
+				{
+					Unlock();
+				}
+			}
+			if (locked)
+			{
+				float lockedScale = scale;
+				if (ImGui::SliderFloat("Locked scale", &lockedScale, 0.1f, 1.0f, "%.2f"))
+				{
+					Lock(lockedScale);
+				}
+			}
+
+			ImGui::DragFloatRange2("Scale range", &settings.minScale, &settings.maxScale, 0.01f, 0.1f, 1.0f, "%.2f");
+			ImGui::DragFloat("Target GPU ms", &settings.targetGpuMs, 0.1f, 1.0f, 100.0f, "%.1f");
+		}
+	}
+}
@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file DynamicResolution.h
+///
+/// @brief Dynamic resolution for the game framebuffer. The scene is rendered
+///        into the lower-left part of a pooled offscreen target at a scale factor
+///        driven by measured GPU time, then upscaled into gameFramebuffer with
+///        a linear blit.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _DYNAMIC_RESOLUTION_H_
+#define _DYNAMIC_RESOLUTION_H_
+
+#include <glew.h>
+#include <array>
+
+namespace Framework {
+
+	struct RenderTarget;
+
+	struct DynamicResolutionSettings
+	{
+		float minScale = 0.5f;          // Lowest scale per axis
+		float maxScale = 1.0f;          // Highest scale per axis, 1.0 is native
+		float targetGpuMs = 14.0f;      // GPU time the controller aims to stay under
+		float scaleStep = 0.05f;        // Scale change per adjustment
+		int cooldownFrames = 20;        // Measured frames between adjustments
+	};
+
+	class DynamicResolution
+	{
+	public:
+		/**
+		 * @brief Creates the GPU timer queries. The scaled target is borrowed from RenderTargetPool per frame.
+		 *
+		 * @param width : output (gameFramebuffer) width in pixels
+		 * @param height : output (gameFramebuffer) height in pixels
+		 */
+		static void Initialize(int width, int height);
+
+		/**
+		 * @brief Binds the target the scene should render into and sets the viewport for the current scale.
+		 *        Called by Graphics::RenderScene instead of binding gameFramebuffer directly.
+		 */
+		static void BeginScene(GLuint outputFramebuffer);
+
+		/**
+		 * @brief Upscales the rendered region into outputFramebuffer, restores the full viewport
+		 *        and feeds the controller with finished GPU timings.
+		 */
+		static void EndScene(GLuint outputFramebuffer);
+
+		/**
+		 * @brief Fixes the scale (clamped to 0.1 - 1.0) so timings are comparable, e.g. for benchmarks.
+		 */
+		static void Lock(float scale);
+
+		// Hands the scale back to the controller
+		static void Unlock();
+
+		static bool IsLocked() { return locked; }
+		static float GetScale() { return scale; }
+		static float GetGpuFrameMs() { return smoothedGpuMs; }
+
+		/**
+		 * @brief Draws the scale, GPU time and controls inside the currently open ImGui window (DebugSystem panel).
+		 */
+		static void ShowImGui();
+
+		static DynamicResolutionSettings settings;
+
+	private:
+		// Timer queries in flight, a frame is not timed while its slot is still pending
+		static constexpr std::size_t TimerSlots = 4;
+
+		static void PollTimers();
+		static void Adjust(double gpuMs);
+
+		// Held between BeginScene and EndScene only
+		static RenderTarget* sceneTarget;
+		static int outputWidth, outputHeight;
+		static int scaledWidth, scaledHeight;
+
+		static float scale;
+		static bool locked;
+		static double smoothedGpuMs;
+		static int framesSinceChange;
+
+		static std::array<GLuint, TimerSlots> timerQueries;
+		static std::array<bool, TimerSlots> timerPending;
+		static std::size_t timerSlot;
+		static bool timerActive;
+	};
+}
+#endif // !_DYNAMIC_RESOLUTION_H_
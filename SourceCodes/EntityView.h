@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file EntityView.h
+///
+/// @brief Cached multi-component joins for systems:
+///
+///          using Sprites = EntityView<With<TransformComponent, RenderComponent>, Without<TextComponent>>;
+///          Sprites& sprites = Sprites::Get(mEntities);
+///          sprites.Refresh();
+///          for (auto [entity, transform, render] : sprites) { ... }
+///
+///        A view is registered with the Coordinator as a system whose
+///        signature is its components, so the Coordinator keeps its entity
+///        set up to date as components are added and removed, and a system
+///        no longer tests each of its entities with HasComponent.
+///
+///        Refresh fetches the components of every match once and keeps the
+///        references in rows; iterating, sorting and Find then do no lookups.
+///        Rows stay valid until a component is added or removed, so a pass
+///        refreshes its views first and does not hold rows across code that
+///        creates or destroys entities. Get registers a view the first time,
+///        so systems that may run in parallel get theirs in Initialize.
+///
+///        Components a system reads one entity at a time, outside a view, go
+///        through CheckedGetComponent / CheckedHasComponent, which in debug
+///        builds check the system's SystemAccess as Refresh does.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _ENTITY_VIEW_H_
+#define _ENTITY_VIEW_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "System.h"
+#include "Coordinator.h"
+#include "ComponentList.h"
+#include "ComponentTypes.h"
+#include "SystemScheduler.h"
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+	// Components an entity must have
+	template <typename... Components>
+	struct With {};
+
+	// Components an entity must not have
+	template <typename... Components>
+	struct Without {};
+
+	// ecsInterface.GetComponent for scheduled systems, debug builds report a component the system did not declare
+	template <typename T>
+	T& CheckedGetComponent(Entity entity)
+	{
+#ifdef _DEBUG
+		SystemScheduler::CheckAccess(ComponentId<T>);
+#endif
+		return ecsInterface.GetComponent<T>(entity);
+	}
+
+	template <typename T>
+	bool CheckedHasComponent(Entity entity)
+	{
+#ifdef _DEBUG
+		SystemScheduler::CheckAccess(ComponentId<T>);
+#endif
+		return ecsInterface.HasComponent<T>(entity);
+	}
+
+	template <typename Include, typename Exclude = Without<>>
+	class EntityView;
+
+	template <typename... Components, typename... Excluded>
+	class EntityView<With<Components...>, Without<Excluded...>> : public ISystem
+	{
+		static_assert(sizeof...(Components) > 0, "EntityView: a view needs at least one component to join on");
+
+	public:
+		struct Row
+		{
+			Entity entity;
+			std::tuple<Components*...> components;
+
+			template <typename T>
+			T& Get() const
+			{
+				return *std::get<T*>(components);
+			}
+		};
+
+		// Yields (entity, component references...) for structured bindings
+		class Iterator
+		{
+		public:
+			explicit Iterator(typename std::vector<Row>::const_iterator row) : row(row) {}
+
+			std::tuple<Entity, Components&...> operator*() const
+			{
+				return std::tuple<Entity, Components&...>(row->entity, *std::get<Components*>(row->components)...);
+			}
+			Iterator& operator++() { ++row; return *this; }
+			bool operator!=(const Iterator& other) const { return row != other.row; }
+
+		private:
+			typename std::vector<Row>::const_iterator row;
+		};
+
+		/**
+		 * @brief The view of these components, registered with the Coordinator on first use.
+		 *
+		 * @param candidates : entities that may already have the components, as the Coordinator only
+		 *                     reports changes made after the view is registered. A system passes its
+		 *                     mEntities, with its own signature among the view's components.
+		 */
+		template <typename Range>
+		static EntityView& Get(const Range& candidates)
+		{
+			if (!instance)
+			{
+				instance = Create(candidates);
+			}
+			return *instance;
+		}
+
+		// Fetches the components of every match, in the Coordinator's entity order
+		void Refresh()
+		{
+#ifdef _DEBUG
+			(SystemScheduler::CheckAccess(ComponentId<Components>), ...);
+#endif
+			for (const Row& row : rows)
+			{
+				rowOf[row.entity] = NoRow;
+			}
+			rows.clear();
+
+			for (Entity entity : mEntities)
+			{
+				if constexpr (sizeof...(Excluded) > 0)
+				{
+					if ((ecsInterface.GetEntitySignature(entity) & SignatureOf<Excluded...>).any())
+					{
+						continue;
+					}
+				}
+				if (rowOf.size() <= entity)
+				{
+					rowOf.resize(entity + 1, NoRow);
+				}
+				rowOf[entity] = static_cast<std::uint32_t>(rows.size());
+				rows.push_back({ entity, std::tuple<Components*...>(&ecsInterface.GetComponent<Components>(entity)...) });
+			}
+		}
+
+		// Reorders the rows, e.g. into draw order, without looking anything up again
+		template <typename Compare>
+		void Sort(Compare compare)
+		{
+			std::sort(rows.begin(), rows.end(), compare);
+			for (std::uint32_t index = 0; index < rows.size(); ++index)
+			{
+				rowOf[rows[index].entity] = index;
+			}
+		}
+
+		// The entity's row as of the last Refresh, nullptr if it does not match
+		const Row* Find(Entity entity) const
+		{
+			return (entity < rowOf.size() && rowOf[entity] != NoRow) ? &rows[rowOf[entity]] : nullptr;
+		}
+
+		const std::vector<Row>& Rows() const { return rows; }
+		std::size_t Size() const { return rows.size(); }
+
+		Iterator begin() const { return Iterator(rows.begin()); }
+		Iterator end() const { return Iterator(rows.end()); }
+
+		// The Coordinator drives the membership, there is nothing to update
+		void Initialize() override {}
+		void Update(float) override {}
+		std::string GetName() override { return "EntityView"; }
+
+	private:
+		static constexpr std::uint32_t NoRow = ~0u;
+
+		template <typename Range>
+		static std::shared_ptr<EntityView> Create(const Range& candidates)
+		{
+			std::shared_ptr<EntityView> view = ecsInterface.RegisterSystem<EntityView>();
+
+			ecsInterface.SetSystemSignature<EntityView>(SignatureOf<Components...>);
+
+			for (Entity entity : candidates)
+			{
+				if ((ecsInterface.HasComponent<Components>(entity) && ...))
+				{
+					view->mEntities.insert(entity);
+				}
+			}
+			return view;
+		}
+
+		inline static std::shared_ptr<EntityView> instance;
+
+		std::vector<Row> rows;
+		std::vector<std::uint32_t> rowOf;   // Indexed by entity
+	};
+}
+#endif // !_ENTITY_VIEW_H_
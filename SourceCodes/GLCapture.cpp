@@ -0,0 +1,602 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GLCapture.cpp
+///
+/// @brief Binary GL frame capture. Commands are stored as
+///        [u8 type][u32 payload size][payload], after a header of
+///        [u32 magic][u32 version][u32 width][u32 height][u32 command count].
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "GLCapture.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace Framework {
+
+	bool GLCapture::captureRequested{};
+	bool GLCapture::recording{};
+	std::string GLCapture::capturePath{};
+	GLCaptureFile GLCapture::current{};
+	std::unordered_set<GLuint> GLCapture::knownPrograms{};
+	std::unordered_set<GLuint> GLCapture::knownVertexArrays{};
+	std::unordered_set<GLuint> GLCapture::knownTextures{};
+	std::unordered_set<GLuint> GLCapture::knownSamplers{};
+	std::unordered_set<GLuint> GLCapture::knownBuffers{};
+
+	// Attributes and buffer bindings snapshotted per VAO, the renderer only uses 0 (position) and 1 (texcoord)
+	static constexpr GLuint CapturedVertexAttribs = 4;
+
+	/*  Payload writing
+	----------------------------------------------------------------------------- */
+	namespace {
+		template <typename T>
+		void Write(std::vector<std::uint8_t>& out, const T& value)
+		{
+			const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+			out.insert(out.end(), bytes, bytes + sizeof(T));
+		}
+
+		void WriteBlob(std::vector<std::uint8_t>& out, const void* data, std::size_t size)
+		{
+			Write(out, static_cast<std::uint32_t>(size));
+			const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+			out.insert(out.end(), bytes, bytes + size);
+		}
+
+		void WriteString(std::vector<std::uint8_t>& out, const char* text)
+		{
+			WriteBlob(out, text, std::strlen(text));
+		}
+	}
+
+	/*  Payload reading
+	----------------------------------------------------------------------------- */
+	void GLCaptureReader::ReadBytes(void* out, std::size_t size)
+	{
+		if (offset + size > data.size())
+		{
+			throw std::runtime_error("GL capture payload is truncated");
+		}
+		std::memcpy(out, data.data() + offset, size);
+		offset += size;
+	}
+
+	std::string GLCaptureReader::ReadString()
+	{
+		std::uint32_t size = 0;
+		const std::uint8_t* bytes = ReadBlob(size);
+		return std::string(reinterpret_cast<const char*>(bytes), size);
+	}
+
+	const std::uint8_t* GLCaptureReader::ReadBlob(std::uint32_t& size)
+	{
+		size = Read<std::uint32_t>();
+		if (offset + size > data.size())
+		{
+			throw std::runtime_error("GL capture payload is truncated");
+		}
+		const std::uint8_t* bytes = data.data() + offset;
+		offset += size;
+		return bytes;
+	}
+
+	/*  Capture control
+	----------------------------------------------------------------------------- */
+	void GLCapture::RequestCapture(const std::string& path)
+	{
+		capturePath = path;
+		captureRequested = true;
+	}
+
+	void GLCapture::BeginCapture()
+	{
+		GLint viewport[4]{};
+		glGetIntegerv(GL_VIEWPORT, viewport);
+
+		current = GLCaptureFile{};
+		current.width = static_cast<std::uint32_t>(viewport[2]);
+		current.height = static_cast<std::uint32_t>(viewport[3]);
+
+		knownPrograms.clear();
+		knownVertexArrays.clear();
+		knownTextures.clear();
+		knownSamplers.clear();
+		knownBuffers.clear();
+
+		captureRequested = false;
+		recording = true;
+	}
+
+	bool GLCapture::EndCapture()
+	{
+		if (!recording)
+		{
+			return false;
+		}
+		recording = false;
+
+		std::ofstream file(capturePath, std::ios::binary);
+		if (!file)
+		{
+			std::cerr << "Failed to open GL capture file: " << capturePath << std::endl;
+			return false;
+		}
+
+		std::vector<std::uint8_t> header;
+		Write(header, FileMagic);
+		Write(header, FileVersion);
+		Write(header, current.width);
+		Write(header, current.height);
+		Write(header, static_cast<std::uint32_t>(current.commands.size()));
+		file.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+		std::size_t totalBytes = header.size();
+		for (const GLCaptureCommand& command : current.commands)
+		{
+			std::uint8_t type = static_cast<std::uint8_t>(command.type);
+			std::uint32_t size = static_cast<std::uint32_t>(command.payload.size());
+			file.write(reinterpret_cast<const char*>(&type), sizeof(type));
+			file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+			file.write(reinterpret_cast<const char*>(command.payload.data()), size);
+			totalBytes += sizeof(type) + sizeof(size) + size;
+		}
+
+		std::cout << "GL capture written to " << capturePath << " (" << current.commands.size() << " commands, "
+			<< totalBytes / 1024 << " KB)" << std::endl;
+
+		// Snapshots can hold every texture in the scene, do not keep them around
+		current = GLCaptureFile{};
+		return true;
+	}
+
+	void GLCapture::Record(GLCommandType type, const std::vector<std::uint8_t>& payload)
+	{
+		current.commands.push_back({ type, payload });
+	}
+
+	/*  Resource snapshots
+	----------------------------------------------------------------------------- */
+	void GLCapture::SnapshotProgram(GLuint program)
+	{
+		if (program == 0 || !knownPrograms.insert(program).second)
+		{
+			return;
+		}
+
+		// Shaders stay attached after linking (UE_Shader never detaches them), so sources can be read back
+		GLuint shaders[8]{};
+		GLsizei shaderCount = 0;
+		glGetAttachedShaders(program, 8, &shaderCount, shaders);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, program);
+		Write(payload, static_cast<std::uint32_t>(shaderCount));
+		for (GLsizei i = 0; i < shaderCount; ++i)
+		{
+			GLint shaderType = 0;
+			GLint sourceLength = 0;
+			glGetShaderiv(shaders[i], GL_SHADER_TYPE, &shaderType);
+			glGetShaderiv(shaders[i], GL_SHADER_SOURCE_LENGTH, &sourceLength);
+
+			std::string source(static_cast<std::size_t>(sourceLength), '\0');
+			if (sourceLength > 0)
+			{
+				glGetShaderSource(shaders[i], sourceLength, nullptr, source.data());
+				source.resize(sourceLength - 1); // Drop the null terminator
+			}
+
+			Write(payload, static_cast<GLenum>(shaderType));
+			WriteString(payload, source.c_str());
+		}
+		Record(GLCommandType::CreateProgram, payload);
+	}
+
+	void GLCapture::SnapshotBuffer(GLuint buffer)
+	{
+		// Deleted names (e.g. the per-draw animation texcoord buffer) are recorded through RecordBufferData instead
+		if (buffer == 0 || !glIsBuffer(buffer) || !knownBuffers.insert(buffer).second)
+		{
+			return;
+		}
+
+		GLint64 size = 0;
+		glGetNamedBufferParameteri64v(buffer, GL_BUFFER_SIZE, &size);
+
+		std::vector<std::uint8_t> data(static_cast<std::size_t>(size));
+		if (size > 0)
+		{
+			glGetNamedBufferSubData(buffer, 0, size, data.data());
+		}
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, buffer);
+		WriteBlob(payload, data.data(), data.size());
+		Record(GLCommandType::CreateBuffer, payload);
+	}
+
+	void GLCapture::SnapshotVertexArray(GLuint vao)
+	{
+		if (vao == 0 || !knownVertexArrays.insert(vao).second)
+		{
+			return;
+		}
+
+		// Binding points are only queryable on the bound VAO
+		GLint previous = 0;
+		glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previous);
+		glBindVertexArray(vao);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, vao);
+		Write(payload, CapturedVertexAttribs);
+
+		std::vector<GLuint> referencedBuffers;
+		for (GLuint i = 0; i < CapturedVertexAttribs; ++i)
+		{
+			GLint enabled = 0, size = 0, type = 0, normalized = 0, relativeOffset = 0, bindingIndex = 0;
+			glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+			glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_ARRAY_SIZE, &size);
+			glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_ARRAY_TYPE, &type);
+			glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &normalized);
+			glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_RELATIVE_OFFSET, &relativeOffset);
+			glGetVertexAttribiv(i, GL_VERTEX_ATTRIB_BINDING, &bindingIndex);
+
+			GLint buffer = 0, stride = 0;
+			GLint64 offset = 0;
+			glGetIntegeri_v(GL_VERTEX_BINDING_BUFFER, i, &buffer);
+			glGetIntegeri_v(GL_VERTEX_BINDING_STRIDE, i, &stride);
+			glGetInteger64i_v(GL_VERTEX_BINDING_OFFSET, i, &offset);
+
+			Write(payload, enabled);
+			Write(payload, size);
+			Write(payload, type);
+			Write(payload, normalized);
+			Write(payload, relativeOffset);
+			Write(payload, bindingIndex);
+			Write(payload, buffer);
+			Write(payload, stride);
+			Write(payload, offset);
+			referencedBuffers.push_back(static_cast<GLuint>(buffer));
+		}
+
+		GLint elementBuffer = 0;
+		glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &elementBuffer);
+		Write(payload, elementBuffer);
+		referencedBuffers.push_back(static_cast<GLuint>(elementBuffer));
+
+		glBindVertexArray(static_cast<GLuint>(previous));
+
+		// Buffer contents go first so the replayer can attach them when creating the VAO
+		for (GLuint buffer : referencedBuffers)
+		{
+			SnapshotBuffer(buffer);
+		}
+		Record(GLCommandType::CreateVertexArray, payload);
+	}
+
+	void GLCapture::SnapshotTexture(GLuint texture)
+	{
+		if (texture == 0 || !knownTextures.insert(texture).second)
+		{
+			return;
+		}
+
+		GLint width = 0, height = 0, levels = 1;
+		glGetTextureLevelParameteriv(texture, 0, GL_TEXTURE_WIDTH, &width);
+		glGetTextureLevelParameteriv(texture, 0, GL_TEXTURE_HEIGHT, &height);
+		glGetTextureParameteriv(texture, GL_TEXTURE_IMMUTABLE_LEVELS, &levels);
+
+		// Stored as RGBA8 whatever the source format, the replayer only needs an equivalent workload
+		std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * 4);
+		if (!pixels.empty())
+		{
+			glGetTextureImage(texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLsizei>(pixels.size()), pixels.data());
+		}
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, texture);
+		Write(payload, width);
+		Write(payload, height);
+		Write(payload, std::max(levels, 1));
+		WriteBlob(payload, pixels.data(), pixels.size());
+		Record(GLCommandType::CreateTexture, payload);
+	}
+
+	void GLCapture::SnapshotSampler(GLuint sampler)
+	{
+		if (sampler == 0 || !knownSamplers.insert(sampler).second)
+		{
+			return;
+		}
+
+		GLint minFilter = 0, magFilter = 0, wrapS = 0, wrapT = 0;
+		glGetSamplerParameteriv(sampler, GL_TEXTURE_MIN_FILTER, &minFilter);
+		glGetSamplerParameteriv(sampler, GL_TEXTURE_MAG_FILTER, &magFilter);
+		glGetSamplerParameteriv(sampler, GL_TEXTURE_WRAP_S, &wrapS);
+		glGetSamplerParameteriv(sampler, GL_TEXTURE_WRAP_T, &wrapT);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, sampler);
+		Write(payload, minFilter);
+		Write(payload, magFilter);
+		Write(payload, wrapS);
+		Write(payload, wrapT);
+		Record(GLCommandType::CreateSampler, payload);
+	}
+
+	/*  Recording hooks
+	----------------------------------------------------------------------------- */
+	void GLCapture::RecordUseProgram(GLuint program)
+	{
+		if (!recording) return;
+		SnapshotProgram(program);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, program);
+		Record(GLCommandType::UseProgram, payload);
+	}
+
+	void GLCapture::RecordBindVertexArray(GLuint vao)
+	{
+		if (!recording) return;
+		SnapshotVertexArray(vao);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, vao);
+		Record(GLCommandType::BindVertexArray, payload);
+	}
+
+	void GLCapture::RecordBindTexture(GLuint texture)
+	{
+		if (!recording) return;
+		SnapshotTexture(texture);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, texture);
+		Record(GLCommandType::BindTexture, payload);
+	}
+
+	void GLCapture::RecordBindSampler(GLuint sampler)
+	{
+		if (!recording) return;
+		SnapshotSampler(sampler);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, sampler);
+		Record(GLCommandType::BindSampler, payload);
+	}
+
+	void GLCapture::RecordBufferData(GLuint buffer, const void* data, std::size_t size)
+	{
+		if (!recording) return;
+		knownBuffers.insert(buffer);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, buffer);
+		WriteBlob(payload, data, size);
+		Record(GLCommandType::BufferData, payload);
+	}
+
+	void GLCapture::RecordVertexArrayVertexBuffer(GLuint vao, GLuint bindingIndex, GLuint buffer, GLintptr offset, GLsizei stride)
+	{
+		if (!recording) return;
+		SnapshotVertexArray(vao);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, vao);
+		Write(payload, bindingIndex);
+		Write(payload, buffer);
+		Write(payload, static_cast<GLint64>(offset));
+		Write(payload, stride);
+		Record(GLCommandType::VertexArrayVertexBuffer, payload);
+	}
+
+	void GLCapture::RecordUniform1i(GLuint program, const char* name, GLint value)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, program);
+		WriteString(payload, name);
+		Write(payload, value);
+		Record(GLCommandType::Uniform1i, payload);
+	}
+
+	void GLCapture::RecordUniform1f(GLuint program, const char* name, GLfloat value)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, program);
+		WriteString(payload, name);
+		Write(payload, value);
+		Record(GLCommandType::Uniform1f, payload);
+	}
+
+	void GLCapture::RecordUniform3f(GLuint program, const char* name, GLfloat x, GLfloat y, GLfloat z)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, program);
+		WriteString(payload, name);
+		Write(payload, x);
+		Write(payload, y);
+		Write(payload, z);
+		Record(GLCommandType::Uniform3f, payload);
+	}
+
+	void GLCapture::RecordUniformMatrix4f(GLuint program, const char* name, const GLfloat* matrix)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, program);
+		WriteString(payload, name);
+		for (int i = 0; i < 16; ++i)
+		{
+			Write(payload, matrix[i]);
+		}
+		Record(GLCommandType::UniformMatrix4f, payload);
+	}
+
+	void GLCapture::RecordEnable(GLenum capability)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, capability);
+		Record(GLCommandType::Enable, payload);
+	}
+
+	void GLCapture::RecordBlendFunc(GLenum source, GLenum destination)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, source);
+		Write(payload, destination);
+		Record(GLCommandType::BlendFunc, payload);
+	}
+
+	void GLCapture::RecordPointSize(GLfloat size)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, size);
+		Record(GLCommandType::PointSize, payload);
+	}
+
+	void GLCapture::RecordLineWidth(GLfloat width)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, width);
+		Record(GLCommandType::LineWidth, payload);
+	}
+
+	void GLCapture::RecordClear(GLbitfield mask)
+	{
+		if (!recording) return;
+
+		GLfloat clearColor[4]{};
+		glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, mask);
+		for (GLfloat channel : clearColor)
+		{
+			Write(payload, channel);
+		}
+		Record(GLCommandType::Clear, payload);
+	}
+
+	void GLCapture::RecordDrawArrays(GLenum mode, GLint first, GLsizei count)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, mode);
+		Write(payload, first);
+		Write(payload, count);
+		Record(GLCommandType::DrawArrays, payload);
+	}
+
+	void GLCapture::RecordDrawElements(GLenum mode, GLsizei count)
+	{
+		if (!recording) return;
+
+		std::vector<std::uint8_t> payload;
+		Write(payload, mode);
+		Write(payload, count);
+		Record(GLCommandType::DrawElements, payload);
+	}
+
+	/*  Loading
+	----------------------------------------------------------------------------- */
+	bool GLCapture::Load(const std::string& path, GLCaptureFile& file)
+	{
+		std::ifstream input(path, std::ios::binary);
+		if (!input)
+		{
+			std::cerr << "Failed to open GL capture file: " << path << std::endl;
+			return false;
+		}
+
+		std::uint32_t magic = 0, version = 0, count = 0;
+		input.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+		input.read(reinterpret_cast<char*>(&version), sizeof(version));
+		input.read(reinterpret_cast<char*>(&file.width), sizeof(file.width));
+		input.read(reinterpret_cast<char*>(&file.height), sizeof(file.height));
+		input.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+		if (!input || magic != FileMagic || version != FileVersion)
+		{
+			std::cerr << "Not a GL capture file or unsupported version: " << path << std::endl;
+			return false;
+		}
+
+		file.commands.clear();
+		file.commands.reserve(count);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			std::uint8_t type = 0;
+			std::uint32_t size = 0;
+			input.read(reinterpret_cast<char*>(&type), sizeof(type));
+			input.read(reinterpret_cast<char*>(&size), sizeof(size));
+
+			GLCaptureCommand command;
+			command.type = static_cast<GLCommandType>(type);
+			command.payload.resize(size);
+			input.read(reinterpret_cast<char*>(command.payload.data()), size);
+
+			if (!input)
+			{
+				std::cerr << "GL capture file is truncated: " << path << std::endl;
+				return false;
+			}
+			file.commands.push_back(std::move(command));
+		}
+		return true;
+	}
+
+	const char* GLCapture::CommandName(GLCommandType type)
+	{
+		switch (type)
+		{
+		case GLCommandType::CreateProgram:           return "CreateProgram";
+		case GLCommandType::CreateBuffer:            return "CreateBuffer";
+		case GLCommandType::CreateVertexArray:       return "CreateVertexArray";
+		case GLCommandType::CreateTexture:           return "CreateTexture";
+		case GLCommandType::CreateSampler:           return "CreateSampler";
+		case GLCommandType::BufferData:              return "BufferData";
+		case GLCommandType::VertexArrayVertexBuffer: return "VertexArrayVertexBuffer";
+		case GLCommandType::UseProgram:              return "UseProgram";
+		case GLCommandType::BindVertexArray:         return "BindVertexArray";
+		case GLCommandType::BindTexture:             return "BindTexture";
+		case GLCommandType::BindSampler:             return "BindSampler";
+		case GLCommandType::Uniform1i:               return "Uniform1i";
+		case GLCommandType::Uniform1f:               return "Uniform1f";
+		case GLCommandType::Uniform3f:               return "Uniform3f";
+		case GLCommandType::UniformMatrix4f:         return "UniformMatrix4f";
+		case GLCommandType::Enable:                  return "Enable";
+		case GLCommandType::BlendFunc:               return "BlendFunc";
+		case GLCommandType::PointSize:               return "PointSize";
+		case GLCommandType::LineWidth:               return "LineWidth";
+		case GLCommandType::Clear:                   return "Clear";
+		case GLCommandType::DrawArrays:              return "DrawArrays";
+		case GLCommandType::DrawElements:            return "DrawElements";
+		}
+		return "Unknown";
+	}
+}
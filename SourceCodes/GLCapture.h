@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GLCapture.h
+///
+/// @brief Records one frame of the renderer's GL command stream (program, VAO
+///        and texture binds, uniform uploads, buffer updates and draws, with
+///        their data) into a compact binary file, and reads it back for the
+///        offline replayer (Benchmarks/GLReplay.cpp).
+///
+///        Resources used during the captured frame are snapshotted the first
+///        time they are seen: shader sources of programs, VAO layouts with
+///        their buffer contents, and texture pixels.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _GL_CAPTURE_H_
+#define _GL_CAPTURE_H_
+
+#include <glew.h>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Framework {
+
+	enum class GLCommandType : std::uint8_t
+	{
+		// Resource snapshots, replayed once
+		CreateProgram = 0,
+		CreateBuffer,
+		CreateVertexArray,
+		CreateTexture,
+		CreateSampler,
+
+		// Frame commands
+		BufferData,
+		VertexArrayVertexBuffer,
+		UseProgram,
+		BindVertexArray,
+		BindTexture,
+		BindSampler,
+		Uniform1i,
+		Uniform1f,
+		Uniform3f,
+		UniformMatrix4f,
+		Enable,
+		BlendFunc,
+		PointSize,
+		LineWidth,
+		Clear,
+		DrawArrays,
+		DrawElements
+	};
+
+	struct GLCaptureCommand
+	{
+		GLCommandType type{};
+		std::vector<std::uint8_t> payload;
+	};
+
+	// Sequential reader over a command payload
+	class GLCaptureReader
+	{
+	public:
+		explicit GLCaptureReader(const std::vector<std::uint8_t>& bytes) : data(bytes) {}
+
+		template <typename T>
+		T Read()
+		{
+			T value{};
+			ReadBytes(&value, sizeof(T));
+			return value;
+		}
+
+		void ReadBytes(void* out, std::size_t size);
+		std::string ReadString();
+		const std::uint8_t* ReadBlob(std::uint32_t& size);
+
+	private:
+		const std::vector<std::uint8_t>& data;
+		std::size_t offset = 0;
+	};
+
+	// Contents of a capture file
+	struct GLCaptureFile
+	{
+		std::uint32_t width = 0;
+		std::uint32_t height = 0;
+		std::vector<GLCaptureCommand> commands;
+	};
+
+	class GLCapture
+	{
+	public:
+		static constexpr std::uint32_t FileMagic = 0x50414347; // "GCAP"
+		static constexpr std::uint32_t FileVersion = 2;
+
+		/**
+		 * @brief Asks for the next rendered frame to be captured into the given file.
+		 */
+		static void RequestCapture(const std::string& path);
+
+		// True when a capture was requested and has not started yet
+		static bool IsCaptureRequested() { return captureRequested; }
+		static bool IsRecording() { return recording; }
+
+		/**
+		 * @brief Starts recording. Called by Graphics::Update at the start of the frame when a capture is requested,
+		 *        with the game framebuffer bound so its viewport size is stored in the file.
+		 */
+		static void BeginCapture();
+
+		/**
+		 * @brief Stops recording and writes the capture file.
+		 *
+		 * @return true if the file was written.
+		 */
+		static bool EndCapture();
+
+		// Recording hooks. Each is a no-op while not recording and is called right after the real GL call.
+		static void RecordUseProgram(GLuint program);
+		static void RecordBindVertexArray(GLuint vao);
+		static void RecordBindTexture(GLuint texture);
+		static void RecordBindSampler(GLuint sampler);
+		static void RecordBufferData(GLuint buffer, const void* data, std::size_t size);
+		static void RecordVertexArrayVertexBuffer(GLuint vao, GLuint bindingIndex, GLuint buffer, GLintptr offset, GLsizei stride);
+		static void RecordUniform1i(GLuint program, const char* name, GLint value);
+		static void RecordUniform1f(GLuint program, const char* name, GLfloat value);
+		static void RecordUniform3f(GLuint program, const char* name, GLfloat x, GLfloat y, GLfloat z);
+		static void RecordUniformMatrix4f(GLuint program, const char* name, const GLfloat* matrix);
+		static void RecordEnable(GLenum capability);
+		static void RecordBlendFunc(GLenum source, GLenum destination);
+		static void RecordPointSize(GLfloat size);
+		static void RecordLineWidth(GLfloat width);
+		static void RecordClear(GLbitfield mask);
+		static void RecordDrawArrays(GLenum mode, GLint first, GLsizei count);
+		static void RecordDrawElements(GLenum mode, GLsizei count);
+
+		/**
+		 * @brief Loads a capture file written by EndCapture.
+		 *
+		 * @return true if the file exists and has a matching magic and version.
+		 */
+		static bool Load(const std::string& path, GLCaptureFile& file);
+
+		// Name of a command type for tool output
+		static const char* CommandName(GLCommandType type);
+
+	private:
+		static void Record(GLCommandType type, const std::vector<std::uint8_t>& payload);
+		static void SnapshotProgram(GLuint program);
+		static void SnapshotVertexArray(GLuint vao);
+		static void SnapshotTexture(GLuint texture);
+		static void SnapshotSampler(GLuint sampler);
+		static void SnapshotBuffer(GLuint buffer);
+
+		static bool captureRequested;
+		static bool recording;
+		static std::string capturePath;
+		static GLCaptureFile current;
+
+		static std::unordered_set<GLuint> knownPrograms;
+		static std::unordered_set<GLuint> knownVertexArrays;
+		static std::unordered_set<GLuint> knownTextures;
+		static std::unordered_set<GLuint> knownSamplers;
+		static std::unordered_set<GLuint> knownBuffers;
+	};
+}
+#endif // !_GL_CAPTURE_H_
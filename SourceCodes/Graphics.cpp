@@ -17,8 +17,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "pch.h"
+#include <filesystem>
+#ifdef _WIN32
 #include <windows.h>
 #include <commdlg.h>
+#endif
 #include "Graphics.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -40,12 +43,40 @@
 #include "Debugger.h"
 #include "ParticleSystem.h"
 #include "UndoSystem.h"
+#include "GraphicsStats.h"
+#include "HeadlessBenchmark.h"
+#include "GLCapture.h"
+#include "GraphicsPicking.h"
+#include "DynamicResolution.h"
+#include "RenderTargetPool.h"
+#include "GraphicsTextures.h"
+#include "TextureResidency.h"
+#include "AssetArchive.h"
+#include "ScenePreloader.h"
+#include "SceneEvents.h"
+#include "AnimationPlayback.h"
+#include "SpriteFrames.h"
+#include "TagIndex.h"
+#include "TimelineSystem.h"
+#include "EntityView.h"
+#include "ComponentTypes.h"
+#include "SystemScheduler.h"
 
 extern Framework::FontSystem fontSystem;
 extern Framework::Coordinator ecsInterface;
 
 namespace Framework {
 
+    // Join of the render pass, Render is in it so Graphics' own entities seed it
+    using SpriteView = EntityView<With<TransformComponent, RenderComponent, LayerComponent>>;
+
+    // A drawable's optional component, read from its signature so nothing is fetched twice or for nothing
+    template <typename T>
+    static T* FindComponent(Entity entity, const Signature& signature)
+    {
+        return signature.test(ComponentId<T>) ? &ecsInterface.GetComponent<T>(entity) : nullptr;
+    }
+
     //initialising containers
     std::vector<Graphics::Model> Graphics::models{};
     std::unordered_map<std::string, Graphics::Model> Graphics::meshes{};
@@ -58,10 +89,28 @@ namespace Framework {
     float Graphics::projMousex{};
     float Graphics::projMousey{};
     Graphics::Camera Graphics::camera({ 800, 600 });
-    GLuint Graphics::gameFramebuffer{}, Graphics::gameTexture{}, Graphics::rbo{}, Graphics::pickingFBO{};
+    GLuint Graphics::gameFramebuffer{}, Graphics::gameTexture{}, Graphics::rbo{};
     bool print_out = false;
 
     static Entity selectedEntity = std::numeric_limits<Entity>::max();  // Sets a selected entity to be a non existent entity out of range
+
+    // Texture handles per entity, indexed by Entity so the render loop does not hash texture names
+    struct EntityTextureBindings
+    {
+        TextureBinding sprite;      // RenderComponent::textureID
+        TextureBinding barBacking;  // UIBarComponent::backingTextureID
+        TextureBinding barFill;     // UIBarComponent::fillTextureID
+    };
+    static std::vector<EntityTextureBindings> entityTextureBindings;
+
+    static EntityTextureBindings& BindingsFor(Entity entity)
+    {
+        if (entity >= entityTextureBindings.size())
+        {
+            entityTextureBindings.resize(static_cast<std::size_t>(entity) + 1);
+        }
+        return entityTextureBindings[entity];
+    }
     static bool isPropertiesWindowOpen = false;                         // Allows opening and closing of the name editor? might want to remove
 
     static bool screenShake = false;
@@ -111,6 +160,7 @@ namespace Framework {
 
     //imgui
     bool Graphics::toggleImGUI = true;
+    bool Graphics::sceneDirty = true;
 
     // Error message and flag for popup
     std::string errorMessage;
@@ -174,27 +224,35 @@ namespace Framework {
         // Clear global maps after cleanup
         Graphics::models.clear();
         Graphics::textures.clear();
+        TextureResidency::Clear();
+        entityTextureBindings.clear();
         Graphics::meshes.clear();
-        ImGui_ImplOpenGL3_Shutdown();
-        ImGui_ImplGlfw_Shutdown();
+        RenderTargetPool::Clear();
+        AssetArchive::Unmount();
+        if (!HeadlessBenchmark::IsEnabled())
+        {
+            ImGui_ImplOpenGL3_Shutdown();
+            ImGui_ImplGlfw_Shutdown();
+        }
         ImGui::DestroyContext();
     }
 
     // Initialize the system
     void Graphics::Initialize()
     {
-        // Register graphics related components 
-        ecsInterface.RegisterComponent<TransformComponent>();
-        ecsInterface.RegisterComponent<RenderComponent>();
-        ecsInterface.RegisterComponent<LayerComponent>();
-        ecsInterface.RegisterComponent<TextComponent>();
+        // Packed release builds read assets from one mapped archive (AssetPacker); without it loose files are used
+        AssetArchive::Mount("Assets.pak");
 
         //  ---- ECS INITIALIZATION --- 
-        Signature signature;
-        signature.set(ecsInterface.GetComponentType<RenderComponent>()); //Set mEntities to be populated with RenderComponent holding Entities
+        ComponentTypes::Register<TransformComponent, RenderComponent, LayerComponent, TextComponent>();
+        Signature signature = SignatureOf<RenderComponent>; //Set mEntities to be populated with RenderComponent holding Entities
 
         ecsInterface.SetSystemSignature<Graphics>(signature);
         std::cout << "Signature for Graphics system is: " << signature << std::endl;
+
+        // The view registers with the Coordinator here rather than mid-frame, beside systems running in parallel
+        SpriteView::Get(mEntities);
+        SystemScheduler::Add(this);
         //  ---- ECS INITIALIZATION END --- 
 
         // --- Create Instances -----
@@ -242,14 +300,33 @@ namespace Framework {
         // Set ImGui Style
         ImGui::StyleColorsDark();
         gameFramebuffer = CreateFramebuffer(static_cast<int>(projWidth), static_cast<int>(projHeight), gameTexture, rbo);
+        DynamicResolution::Initialize(static_cast<int>(projWidth), static_cast<int>(projHeight));
+
+        // Benchmarks run at a fixed scale unless asked to measure the controller
+        if (HeadlessBenchmark::IsEnabled() && !HeadlessBenchmark::settings.dynamicResolution)
+        {
+            DynamicResolution::Lock(HeadlessBenchmark::settings.resolutionScale);
+        }
 
-        // Initialize backends
-        ImGui_ImplGlfw_InitForOpenGL(graphicWindows->GetWindow(), true);
-        ImGui_ImplOpenGL3_Init("#version 450");
+        // Initialize backends (no editor UI when running headless)
+        if (!HeadlessBenchmark::IsEnabled())
+        {
+            ImGui_ImplGlfw_InitForOpenGL(graphicWindows->GetWindow(), true);
+            ImGui_ImplOpenGL3_Init("#version 450");
+
+            // Entity ID buffer for viewport picking comes from RenderTargetPool when a pick is rendered
+            GraphicsPicking::Initialize(UE_vs, UE_fs2);
+        }
 
         //INIT Font system
         fontSystem.Initialize();
 
+        // Shared samplers must exist before the first mesh texture is loaded
+        GraphicsTextures::Initialize();
+
+        // Likewise trimmed atlases (SpriteTrimmer) must replace their grid sheets before any is loaded
+        SpriteFrames::Load("Assets/JsonData/AnimationFrames.json");
+
         // IMPORTANT : setting color of background for program
         SetBackgroundColor(255, 255, 255, 255);
 
@@ -258,23 +335,43 @@ namespace Framework {
         createMesh(vertices, texCoords, color, "animation", "McIdleSprite");
     }
 
-    // Update the system
-    void Graphics::Update(float deltaTime)
+    // Whether gameFramebuffer has to be rendered this frame
+    bool Graphics::NeedsSceneRender() const
     {
-        //updateShake(deltaTime);
-        //startShake(100.0f, 20.0f);
-        //glViewport(
-        //    static_cast<GLint>(shakeOffsetX),
-        //    static_cast<GLint>(shakeOffsetY),
-        //    static_cast<GLsizei>(projWidth),
-        //    static_cast<GLsizei>(projHeight)
-        //);
-        // Bind framebuffer
-        glBindFramebuffer(GL_FRAMEBUFFER, gameFramebuffer);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // Without the editor the scene goes straight to the window's back buffer, which is undefined after a swap
+        if (HeadlessBenchmark::IsEnabled() || !toggleImGUI)
+        {
+            return true;
+        }
 
-        (void)deltaTime;
-        // Render your scene, but output entity IDs as colors to the pickingFBO
+        // Play mode, the on-screen FPS counter and frame captures need a fresh frame every time
+        if ((engineState.IsPlay() && !engineState.IsPaused()) || engineState.IsDisplayFPS() || GLCapture::IsCaptureRequested())
+        {
+            return true;
+        }
+
+        // Entities created or destroyed (scene loads, prefabs, deletes) since the last render
+        return sceneDirty || CurrentSize != static_cast<unsigned int>(mEntities.size());
+    }
+
+    void Graphics::MarkSceneDirty()
+    {
+        sceneDirty = true;
+    }
+
+    // Renders all entities into gameFramebuffer
+    void Graphics::RenderScene()
+    {
+        // Bind the scene target, scaled by dynamic resolution and upscaled into gameFramebuffer in EndScene
+        DynamicResolution::BeginScene(gameFramebuffer);
+
+        // Record this frame's scene rendering if a capture was requested
+        if (GLCapture::IsCaptureRequested())
+        {
+            GLCapture::BeginCapture();
+        }
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        GLCapture::RecordClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         //  ------ Graphics Rendering Pipeline START -----
         models.clear();
@@ -282,37 +379,36 @@ namespace Framework {
         //  if (CurrentSize != mEntities.size()) {
             // Populate the sortedEntities vector with elements from the mEntities set
 
-        sortedEntities.assign(mEntities.begin(), mEntities.end());
+        // Transform, render and layer of every drawable are fetched once here; the pass below fetches the
+        // animation, bar, text and collider of an entity that has one, once, when it gets to draw it
+        SpriteView& sprites = SpriteView::Get(mEntities);
+        sprites.Refresh();
+        bool drawColliders = engineState.IsInDebugMode();
 
         // Sort based on LayerID, then SortID, and finally Entity ID
-        std::sort(sortedEntities.begin(), sortedEntities.end(), [](Entity a, Entity b) {
-            auto& layerA = ecsInterface.GetComponent<LayerComponent>(a);
-            auto& layerB = ecsInterface.GetComponent<LayerComponent>(b);
-
-            // First, compare LayerID
-            if (layerA.layerID != layerB.layerID) {
-                return layerA.layerID < layerB.layerID;
-            }
-
-            // If LayerID is the same, compare SortID
-            if (layerA.sortID != layerB.sortID) {
-                return layerA.sortID < layerB.sortID;
-            }
-
-            // If both LayerID and SortID are the same, fall back to Entity ID
-            return a < b;
-            });
+        sprites.Sort([](const SpriteView::Row& a, const SpriteView::Row& b) {
+            return CompareRenderOrder(a.Get<LayerComponent>(), a.entity, b.Get<LayerComponent>(), b.entity);
+        });
+        sortedEntities.clear();
+        for (const SpriteView::Row& row : sprites.Rows()) {
+            sortedEntities.push_back(row.entity);
+        }
 
         // Update CurrentSize to reflect the new size of mEntities
         CurrentSize = static_cast<unsigned int>(mEntities.size());
         //  }
 
-        for (auto const& entityId : sortedEntities)
+        // Interned once, each entity's check below is a bit test
+        static const TagId winUITag = TagIndex::Intern("WinUI");
+        static const TagId loseUITag = TagIndex::Intern("LoseUI");
+
+        for (const SpriteView::Row& sprite : sprites.Rows())
         {
             // Get Components needed
-            TransformComponent& transformComponent = ecsInterface.GetComponent<TransformComponent>(entityId);
-            RenderComponent& renderComponent = ecsInterface.GetComponent<RenderComponent>(entityId);
-            LayerComponent& layerComponent = ecsInterface.GetComponent<LayerComponent>(entityId);
+            Entity entityId = sprite.entity;
+            TransformComponent& transformComponent = sprite.Get<TransformComponent>();
+            RenderComponent& renderComponent = sprite.Get<RenderComponent>();
+            LayerComponent& layerComponent = sprite.Get<LayerComponent>();
 
  
             //Skip render base on visibility of layer
@@ -321,7 +417,7 @@ namespace Framework {
             }
 
             
-            if(ecsInterface.HasTag(entityId, "WinUI"))
+            if(TagIndex::Has(entityId, winUITag))
             {
                 if (engineState.IsWin())
                 {
@@ -343,7 +439,7 @@ namespace Framework {
                 }
             }
 
-            if(ecsInterface.HasTag(entityId, "LoseUI"))
+            if(TagIndex::Has(entityId, loseUITag))
             {
                 if (engineState.IsLose())
                 {
@@ -368,78 +464,64 @@ namespace Framework {
             if (!renderComponent.isActive) {
                 continue; // ues this line to ensure its active before it operates
             }
+            Signature signature = ecsInterface.GetEntitySignature(entityId);
 
             // Creating animation sprite in here //
-            if (ecsInterface.HasComponent<AnimationComponent>(entityId)) {
-                if (ecsInterface.HasComponent<CollisionComponent>(entityId)) {
-                    CollisionComponent& playercol = ecsInterface.GetComponent<CollisionComponent>(entityId);
-                    (void)playercol;
-                }
-                AnimationComponent& animationComponent = ecsInterface.GetComponent<AnimationComponent>(entityId);
-                if (animationComponent.currentAnimation != renderComponent.textureID) {
-                    animationComponent.currentAnimation = renderComponent.textureID;
-                    animationComponent.animationTimeStart = static_cast<float>(glfwGetTime());  // Reset animation start time
-                    animationComponent.currentFrame = 0;
-                }
+            AnimationComponent* animation = FindComponent<AnimationComponent>(entityId, signature);
+            if (animation) {
+                AnimationComponent& animationComponent = *animation;
                 Graphics::Model& modelanim = getMesh("animation");
-                if (textures.find(renderComponent.textureID) == textures.end()) {
-                    textures[renderComponent.textureID] = GlobalAssetManager.UE_LoadTextureToOpenGL(renderComponent.textureID);
-                }
-                modelanim.textureID = textures[renderComponent.textureID];
-                glm::vec2 scale_anim(transformComponent.scale.x, transformComponent.scale.y);
-                glm::vec2 transla(transformComponent.position.x, transformComponent.position.y);
-                modelanim.modelMatrix = Graphics::calculate2DTransform(transla, 0.0f, scale_anim);
-                float elapsedTime = static_cast<float>(glfwGetTime() - animationComponent.animationTimeStart);
-                if (!engineState.IsPaused())
-                {
-                    animationComponent.currentFrame = (int)(elapsedTime * animationComponent.animationSpeed) % (animationComponent.rows * animationComponent.cols);
-                }
-                else
+                EntityTextureBindings& animBindings = BindingsFor(entityId);
+                modelanim.textureID = animBindings.sprite.Get(renderComponent.textureID);
+                modelanim.premultipliedAlpha = animBindings.sprite.IsPremultiplied();
+                // The AnimationSystem advances playback, the frame is only read here
+                int frame = AnimationPlayback::DrawnFrame(entityId, animationComponent.rows * animationComponent.cols);
+
+                // Trimmed sheets cover only the opaque part of the cell, an empty frame draws nothing
+                SpriteFrame spriteFrame = SpriteFrames::FrameOf(renderComponent.textureID, frame, animationComponent.cols, animationComponent.rows);
+                if (!spriteFrame.IsEmpty())
                 {
-                    animationComponent.currentFrame = (int)(animationComponent.animationSpeed) % (animationComponent.rows * animationComponent.cols);
+                    glm::vec2 scale_anim(transformComponent.scale.x, transformComponent.scale.y);
+                    glm::vec2 transla(transformComponent.position.x, transformComponent.position.y);
+                    glm::vec2 quadCenter(spriteFrame.quadRect.x + spriteFrame.quadRect.z * 0.5f, spriteFrame.quadRect.y + spriteFrame.quadRect.w * 0.5f);
+                    modelanim.modelMatrix = Graphics::calculate2DTransform(transla + scale_anim * quadCenter, 0.0f,
+                        scale_anim * glm::vec2(spriteFrame.quadRect.z, spriteFrame.quadRect.w));
+                    modelanim.alpha = renderComponent.alpha;
+                    modelanim.color = renderComponent.color;
+
+                    drawMeshWithAnimation(modelanim, spriteFrame.uvRect);
+                    modelanim.draw();
                 }
-                
-                
-               // animationComponent.currentFrame = (int)(elapsedTime * animationComponent.animationSpeed) % (animationComponent.rows*animationComponent.cols);
-                modelanim.alpha = renderComponent.alpha;
-                modelanim.color = renderComponent.color;
-                
-                drawMeshWithAnimation(modelanim, animationComponent.currentFrame, animationComponent.cols, animationComponent.rows);
-                modelanim.draw();
             }
             
             //check if they do not have animation component, this way render wont render over the animation
-            if (!(ecsInterface.HasComponent<AnimationComponent>(entityId))) {
-                if (ecsInterface.HasComponent<RenderComponent>(entityId)) {
-                    // Sprite rendering
-                    Graphics::Model& model = getMesh("sprite"); // Use for mesh
-
-                    // Loads the texture if it�s not loaded into map
-                    if (textures.find(renderComponent.textureID) == textures.end()) {
-                        textures[renderComponent.textureID] = GlobalAssetManager.UE_LoadTextureToOpenGL(renderComponent.textureID);
-                    }
+            if (!animation) {
+                // Sprite rendering
+                Graphics::Model& model = getMesh("sprite"); // Use for mesh
 
-                    model.textureID = textures[renderComponent.textureID]; // Assign loaded texture ID to model
+                // Cached handle, the name is only resolved again when it changes
+                EntityTextureBindings& spriteBindings = BindingsFor(entityId);
+                model.textureID = spriteBindings.sprite.Get(renderComponent.textureID); // Assign loaded texture ID to model
+                model.premultipliedAlpha = spriteBindings.sprite.IsPremultiplied();
 
-                    // TRANSLATE, ROTATE, SCALE
-                    glm::vec2 translation(transformComponent.position.x, transformComponent.position.y);
-                    float rotation = transformComponent.rotation;
-                    glm::vec2 scale(transformComponent.scale.x, transformComponent.scale.y);
+                // TRANSLATE, ROTATE, SCALE
+                glm::vec2 translation(transformComponent.position.x, transformComponent.position.y);
+                float rotation = transformComponent.rotation;
+                glm::vec2 scale(transformComponent.scale.x, transformComponent.scale.y);
 
-                    // SET MATRIX
-                    model.modelMatrix = Graphics::calculate2DTransform(translation, rotation, scale);
+                // SET MATRIX
+                model.modelMatrix = Graphics::calculate2DTransform(translation, rotation, scale);
 
-                    // Set color and alpha 
-                    model.color = renderComponent.color;
-                    model.alpha = renderComponent.alpha;
+                // Set color and alpha 
+                model.color = renderComponent.color;
+                model.alpha = renderComponent.alpha;
 
-                    // Draw the model
-                    model.draw();
-                }
+                // Draw the model
+                model.draw();
             }
             
-            if (ecsInterface.HasComponent<UIBarComponent>(entityId)) {
-                const UIBarComponent& barComponent = ecsInterface.GetComponent<UIBarComponent>(entityId);
+            if (const UIBarComponent* bar = FindComponent<UIBarComponent>(entityId, signature)) {
+                const UIBarComponent& barComponent = *bar;
 
                 // === Bar position (backing) ===
                 glm::vec2 barPos = transformComponent.position + barComponent.offset;
@@ -448,10 +530,9 @@ namespace Framework {
                 Graphics::Model& model = getMesh("sprite");
 
                 // === Draw Background Bar ===
-                if (textures.find(barComponent.backingTextureID) == textures.end()) {
-                    textures[barComponent.backingTextureID] = GlobalAssetManager.UE_LoadTextureToOpenGL(barComponent.backingTextureID);
-                }
-                model.textureID = textures[barComponent.backingTextureID];
+                EntityTextureBindings& barBindings = BindingsFor(entityId);
+                model.textureID = barBindings.barBacking.Get(barComponent.backingTextureID);
+                model.premultipliedAlpha = barBindings.barBacking.IsPremultiplied();
 
                 model.modelMatrix = Graphics::calculate2DTransform(barPos, 0.0f, barComponent.scale);
                 model.color = glm::vec4(barComponent.bgColor, barComponent.bgAlpha);
@@ -459,10 +540,8 @@ namespace Framework {
                 model.draw();
 
                 // === Draw Fill Bar ===
-                if (textures.find(barComponent.fillTextureID) == textures.end()) {
-                    textures[barComponent.fillTextureID] = GlobalAssetManager.UE_LoadTextureToOpenGL(barComponent.fillTextureID);
-                }
-                model.textureID = textures[barComponent.fillTextureID];
+                model.textureID = barBindings.barFill.Get(barComponent.fillTextureID);
+                model.premultipliedAlpha = barBindings.barFill.IsPremultiplied();
 
                 // Calculate filled size using fillSize instead of scale
                 glm::vec2 filledSize(
@@ -481,11 +560,12 @@ namespace Framework {
             }
 
 
-            if (ecsInterface.HasComponent<TextComponent>(entityId)) {
+            if (TextComponent* text = FindComponent<TextComponent>(entityId, signature)) {
                 // Text rendering
-                TextComponent& textComponent = ecsInterface.GetComponent<TextComponent>(entityId);
+                TextComponent& textComponent = *text;
 
-                // Set active font
+                // Set active font, the font atlas uses its own texture parameters
+                GraphicsTextures::UnbindSampler();
                 fontSystem.SetActiveFont(textComponent.fontName);
                 // Calculate position based on TransformComponent + offset
                 glm::vec2  textPosition = transformComponent.position + textComponent.offset;
@@ -503,27 +583,77 @@ namespace Framework {
                     textComponent.color,
                     projection
                 );
+                GraphicsStats::CountText(textComponent.text.size());
             }
 
-            if (ecsInterface.HasComponent<CollisionComponent>(entityId)) {
-                if (engineState.IsInDebugMode()) {
-                    CollisionComponent& collisionComponent = ecsInterface.GetComponent<CollisionComponent>(entityId);
+            if (drawColliders) {
+                if (CollisionComponent* collider = FindComponent<CollisionComponent>(entityId, signature)) {
+                    CollisionComponent& collisionComponent = *collider;
                     // Renders debug box using collision component
                     Graphics::DrawDebugBox(transformComponent.position, collisionComponent.scale.x, collisionComponent.scale.y); // For example, drawing a debug box
                 }
             }
+        }
 
-            //Draw fps here
-            if (engineState.IsDisplayFPS()) {
-                RenderFPS(projWidth, projHeight);
-            }
+        //Draw fps here, once on top of the scene
+        if (engineState.IsDisplayFPS()) {
+            RenderFPS(projWidth, projHeight);
         }
 
         for (auto& model : models)
         {
             model.draw(); // Call the draw function on each model
         }
-        if (Graphics::toggleImGUI == false)
+        GraphicsTextures::UnbindSampler();
+        GLCapture::EndCapture();
+        DynamicResolution::EndScene(gameFramebuffer);
+    }
+
+    // Update the system
+    void Graphics::Update(float deltaTime)
+    {
+        if (SystemScheduler::Dispatch(this, deltaTime))
+        {
+            return;
+        }
+
+        //updateShake(deltaTime);
+        //startShake(100.0f, 20.0f);
+        //glViewport(
+        //    static_cast<GLint>(shakeOffsetX),
+        //    static_cast<GLint>(shakeOffsetY),
+        //    static_cast<GLsizei>(projWidth),
+        //    static_cast<GLsizei>(projHeight)
+        //);
+        GraphicsStats::BeginFrame();
+
+        (void)deltaTime;
+
+        // Textures of the next scene decoded by the preload workers, a few uploads per frame
+        ScenePreloader::Update();
+
+        // WinUI/LoseUI checks below must not see the tags of a destroyed entity whose id was reused
+        TagIndex::Sync();
+
+        // Outside play mode the scene is only re-rendered when something changed, the viewport keeps showing the last gameTexture
+        if (NeedsSceneRender())
+        {
+            RenderScene();
+            sceneDirty = false;
+        }
+
+        // Editor picking pass, only renders when the viewport asked for a pick
+        if (Graphics::toggleImGUI && !HeadlessBenchmark::IsEnabled())
+        {
+            GraphicsPicking::Update(sortedEntities);
+        }
+
+        if (HeadlessBenchmark::IsEnabled())
+        {
+            // Headless: the scene stays in gameFramebuffer, no editor UI
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        }
+        else if (Graphics::toggleImGUI == false)
         {
             //// Bind the default framebuffer again
             gameFramebuffer = 0;
@@ -592,6 +722,7 @@ namespace Framework {
                             ecsInterface.ClearEntities();
                             entityAssets.clear();
                             GlobalAssetManager.UE_LoadEntities(filePath);
+                            SceneEvents::OnSceneLoaded(filePath);
                             //GlobalAudio.UE_Reset();
 
                             // Revert to the directory two levels above the original directory
@@ -678,7 +809,8 @@ namespace Framework {
                     for (auto& texturePair : textureAssets)
                     {
                         const std::string& assetName = texturePair.first;
-                        GLuint textureID = GlobalAssetManager.UE_LoadTextureToOpenGL(assetName);
+                        // Browsing must not load every texture or keep them all from eviction, only resident ones are shown
+                        GLuint textureID = TextureResidency::Peek(assetName);
                         ImTextureID imguiTextureID = static_cast<ImTextureID>(textureID);
 
                         ImGui::PushID(assetName.c_str());  // Ensure unique ID
@@ -686,6 +818,17 @@ namespace Framework {
 
                         // Display the texture icon
                         ImGui::Image(imguiTextureID, ImVec2(iconSize, iconSize));
+                        if (textureID == 0)
+                        {
+                            // Placeholder until the texture is in VRAM, hovering loads it
+                            ImGui::GetWindowDrawList()->AddRectFilled(ImGui::GetItemRectMin(), ImGui::GetItemRectMax(), IM_COL32(60, 60, 60, 255));
+                            ImGui::GetWindowDrawList()->AddText(ImVec2(ImGui::GetItemRectMin().x + 4.0f, ImGui::GetItemRectMin().y + 4.0f),
+                                IM_COL32(160, 160, 160, 255), "...");
+                            if (ImGui::IsItemHovered())
+                            {
+                                GetTexture(assetName);
+                            }
+                        }
 
                         // Highlight selected texture with a border
                         if (selectedTextureName == assetName)
@@ -760,6 +903,7 @@ namespace Framework {
                     for (const auto& [oldName, newName] : nameUpdates)
                     {
                         GlobalAssetManager.UE_UpdateTextureName(oldName, newName);
+                        TextureResidency::Rename(oldName, newName); // Live handles follow the asset
                         std::cout << "Renamed texture: " << oldName << " to " << newName << std::endl;
                     }
                     nameUpdates.clear();
@@ -767,6 +911,7 @@ namespace Framework {
                     // Apply deletions
                     for (const auto& textureName : texturesToDelete)
                     {
+                        TextureResidency::Remove(textureName);
                         GlobalAssetManager.UE_DeleteTexture(textureName);
                         std::cout << "Deleted texture: " << textureName << std::endl;
                     }
@@ -1284,6 +1429,7 @@ namespace Framework {
                             isPropertiesWindowOpen = false;
                             // Clear all objects and reset fields
                             ecsInterface.ClearEntities();
+                            TagIndex::Clear();
                             models.clear();
 
                             ImGui::CloseCurrentPopup(); // Close the popup
@@ -1315,6 +1461,7 @@ namespace Framework {
                             if (selectedEntity != std::numeric_limits<Entity>::max())
                             {
                                 ecsInterface.DestroyEntity(selectedEntity);
+                                TagIndex::RemoveEntity(selectedEntity);
                             }
                             ImGui::CloseCurrentPopup(); // Close the popup
                         }
@@ -1416,7 +1563,7 @@ namespace Framework {
                                     {
                                         if (!tag.empty()) // Avoid adding empty tags
                                         {
-                                            ecsInterface.AddTag(selectedEntity, tag);
+                                            TagIndex::Add(selectedEntity, TagIndex::Intern(tag));
 
                                         }
                                     }
@@ -1478,7 +1625,7 @@ namespace Framework {
                         if (hasAnyComponent)
                         {
                             // Checks if there is MovementComponent. If yes, show its variables
-                            if (entitySignature.test(0))    // MovementComponent
+                            if (entitySignature.test(ComponentId<MovementComponent>))
                             {
                                 MovementComponent& movementComponent = ecsInterface.GetComponent<MovementComponent>(selectedEntity);
 
@@ -1511,7 +1658,7 @@ namespace Framework {
 
                                     if (ImGui::Button("Remove Movement Component"))
                                     {
-                                        inverseSignature.flip(0);
+                                        inverseSignature.flip(ComponentId<MovementComponent>);
                                         
                                         // Push undo before removing the component
                                         undoRedoManager.PushUndoComponent(selectedEntity, movementComponent);
@@ -1527,11 +1674,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(0);    // Sets the signature for MovementComponent to be 1. Means the selected entity doesn't have.
+                                inverseSignature.set(ComponentId<MovementComponent>);    // Sets the signature for MovementComponent to be 1. Means the selected entity doesn't have.
                             }
 
                             // Checks if there is EnemyComponent. If yes, show its variables
-                            if (entitySignature.test(1))    // EnemyComponent
+                            if (entitySignature.test(ComponentId<EnemyComponent>))
                             {
                                 EnemyComponent& enemyComponent = ecsInterface.GetComponent<EnemyComponent>(selectedEntity);
 
@@ -1597,7 +1744,7 @@ namespace Framework {
                                     // Store full EnemyComponent before removal
                                     undoRedoManager.PushUndoComponent(selectedEntity, enemyComponent);
 
-                                    inverseSignature.flip(1);
+                                    inverseSignature.flip(ComponentId<EnemyComponent>);
                                     if (ecsInterface.HasComponent<MovementComponent>(selectedEntity)) {
                                         MovementComponent& movement = ecsInterface.GetComponent<MovementComponent>(selectedEntity);
                                         movement.velocity.x = 0;
@@ -1612,12 +1759,12 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(1);    // Sets the signature for EnemyComponent to be 1. Means the selected entity doesn't have.
+                                inverseSignature.set(ComponentId<EnemyComponent>);    // Sets the signature for EnemyComponent to be 1. Means the selected entity doesn't have.
                             }
 
                             // Checks if there is CollisionComponent. If yes, show its variables
                             // IDK if we need to show anything now??? But definitely need to be able to edit radius if the scale of the object is different
-                            if (entitySignature.test(2))    // CollisionComponent
+                            if (entitySignature.test(ComponentId<CollisionComponent>))
                             {
                                 CollisionComponent& collisionComponent = ecsInterface.GetComponent<CollisionComponent>(selectedEntity);
 
@@ -1646,7 +1793,7 @@ namespace Framework {
 
                                 if (ImGui::Button("Remove Collision Component"))
                                 {
-                                    inverseSignature.flip(2);
+                                    inverseSignature.flip(ComponentId<CollisionComponent>);
                                     undoRedoManager.PushUndoComponent(selectedEntity, collisionComponent);
                                     ecsInterface.RemoveComponent<CollisionComponent>(selectedEntity);
                                     entitySignature = ecsInterface.GetEntitySignature(selectedEntity); // Fetch updated signature
@@ -1657,11 +1804,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(2);    // Sets the signature for CollisionComponent to be 1. Means the selected entity doesn't have.
+                                inverseSignature.set(ComponentId<CollisionComponent>);    // Sets the signature for CollisionComponent to be 1. Means the selected entity doesn't have.
                             }
 
                             // Checks if there is AnimationComponent. If yes, show its variables
-                            if (entitySignature.test(3))    // AnimationComponent
+                            if (entitySignature.test(ComponentId<AnimationComponent>))
                             {
                                 AnimationComponent& animationComponent = ecsInterface.GetComponent<AnimationComponent>(selectedEntity);
 
@@ -1701,10 +1848,10 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(3);    // Sets the signature for AnimationComponent to be 1. Means the selected entity doesn't have.
+                                inverseSignature.set(ComponentId<AnimationComponent>);    // Sets the signature for AnimationComponent to be 1. Means the selected entity doesn't have.
                             }
 
-                            if (entitySignature.test(4))    // BulletComponent
+                            if (entitySignature.test(ComponentId<BulletComponent>))
                             {
                                 //ImGui::Spacing();
                                 //ImGui::Separator();
@@ -1712,11 +1859,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(4);
+                                inverseSignature.set(ComponentId<BulletComponent>);
                             }
 
                             // Checks if there is TransformComponent. If yes, show its variables
-                            if (entitySignature.test(5))    // TransformComponent
+                            if (entitySignature.test(ComponentId<TransformComponent>))
                             {
                                 TransformComponent& transformComponent = ecsInterface.GetComponent<TransformComponent>(selectedEntity);
 
@@ -1789,11 +1936,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(5);    // Sets the signature for TransformComponent to be 1. Means the selected entity doesn't have.
+                                inverseSignature.set(ComponentId<TransformComponent>);    // Sets the signature for TransformComponent to be 1. Means the selected entity doesn't have.
                             }
 
                             // Checks if there is RenderComponent. If yes, show its variables
-                            if (entitySignature.test(6))    // RenderComponent
+                            if (entitySignature.test(ComponentId<RenderComponent>))
                             {
                                 RenderComponent& renderComponent = ecsInterface.GetComponent<RenderComponent>(selectedEntity);
 
@@ -1859,10 +2006,10 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(6);
+                                inverseSignature.set(ComponentId<RenderComponent>);
                             }
                                 // Checks if there is LayerCompomnent. If yes, show its variables
-                                if (entitySignature.test(7))    // LayerComponent
+                                if (entitySignature.test(ComponentId<LayerComponent>))
                                 {
                                     if (ImGui::CollapsingHeader("Layer Component", ImGuiTreeNodeFlags_DefaultOpen))
                                     {
@@ -1898,11 +2045,11 @@ namespace Framework {
                                 }
                                 else
                                 {
-                                    inverseSignature.set(7);
+                                    inverseSignature.set(ComponentId<LayerComponent>);
                                 }
 
                                 // Checks if there is TextComponent. If yes, show its variables
-                                if (entitySignature.test(8)) // TextComponent
+                                if (entitySignature.test(ComponentId<TextComponent>))
                                 {
                                     if (ImGui::CollapsingHeader("Text Component", ImGuiTreeNodeFlags_DefaultOpen))
                                     {
@@ -1990,7 +2137,7 @@ namespace Framework {
 
                                         if (ImGui::Button("Remove Text Component")) 
                                         {
-                                            inverseSignature.flip(8);
+                                            inverseSignature.flip(ComponentId<TextComponent>);
                                             undoRedoManager.PushUndoComponent(selectedEntity, textComponent);
                                             ecsInterface.RemoveComponent<TextComponent>(selectedEntity);
                                             entitySignature = ecsInterface.GetEntitySignature(selectedEntity); 
@@ -1999,11 +2146,11 @@ namespace Framework {
                                 }
                                 else
                                 {
-                                    inverseSignature.set(8);
+                                    inverseSignature.set(ComponentId<TextComponent>);
                                 }
 
                             // Checks if there is PlayerComponent. If yes, show its variables
-                            if (entitySignature.test(9))    // PlayerComponent
+                            if (entitySignature.test(ComponentId<PlayerComponent>))
                             {
                                 PlayerComponent& playerComponent = ecsInterface.GetComponent<PlayerComponent>(selectedEntity);
 
@@ -2013,7 +2160,7 @@ namespace Framework {
 
                                 if (ImGui::Button("Remove Player Component"))
                                 {
-                                    inverseSignature.flip(2);
+                                    inverseSignature.flip(ComponentId<PlayerComponent>);
                                     
                                     if (ecsInterface.HasComponent<MovementComponent>(selectedEntity)) {
                                         MovementComponent& movement = ecsInterface.GetComponent<MovementComponent>(selectedEntity);
@@ -2031,11 +2178,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(9);
+                                inverseSignature.set(ComponentId<PlayerComponent>);
                             }
 
                             // Checks if there is ButtonCompomnent. If yes, show its variables
-                            if (entitySignature.test(10))    // ButtonComponent
+                            if (entitySignature.test(ComponentId<ButtonComponent>))
                             {
                                 if (ImGui::CollapsingHeader("Button Component", ImGuiTreeNodeFlags_DefaultOpen))
                                 {
@@ -2250,11 +2397,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(10);
+                                inverseSignature.set(ComponentId<ButtonComponent>);
                             }
 
                             // Checks if there is a TimelineComponent. If yes, show its variables
-                            if (entitySignature.test(11))    // TimelineComponent
+                            if (entitySignature.test(ComponentId<TimelineComponent>))
                             {
                                 if (ImGui::CollapsingHeader("Timeline Component", ImGuiTreeNodeFlags_DefaultOpen))
                                 {
@@ -2314,6 +2461,7 @@ namespace Framework {
                                         if (newTimelineTag != prevTimelineTag)
                                         {
                                             timelineComponent.TimelineTag = newTimelineTag;
+                                            TimelineSystem::TimelineTagsEdited();
                                             undoRedoManager.PushUndo(selectedEntity, "TimelineComponent", "TimelineTag", timelineComponent.TimelineTag, prevTimelineTag, timelineComponent.TimelineTag);
                                         }
                                     }
@@ -2413,11 +2561,11 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(11);
+                                inverseSignature.set(ComponentId<TimelineComponent>);
                             }
 
                             // Checks if there is ParticleComponent. If yes, show its variables
-                            if (entitySignature.test(12))    // ParticleComponent
+                            if (entitySignature.test(ComponentId<ParticleComponent>))
                             {
                                 if (ImGui::CollapsingHeader("Particle Component", ImGuiTreeNodeFlags_DefaultOpen))
                                 {
@@ -2570,10 +2718,10 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(12); // If no particle component, mark it for future additions
+                                inverseSignature.set(ComponentId<ParticleComponent>); // If no particle component, mark it for future additions
                             }
 
-                            if (entitySignature.test(13))    // SpawnerComponent
+                            if (entitySignature.test(ComponentId<SpawnerComponent>))
                             {
                                 if (ImGui::CollapsingHeader("Spawner Component", ImGuiTreeNodeFlags_DefaultOpen))
                                 {
@@ -2590,7 +2738,7 @@ namespace Framework {
 
                                         if (ImGui::Button("Remove Spawner Component"))
                                         {
-                                            inverseSignature.flip(13);
+                                            inverseSignature.flip(ComponentId<SpawnerComponent>);
                                             undoRedoManager.PushUndoComponent(selectedEntity, spawnerComponent);
                                             ecsInterface.RemoveComponent<SpawnerComponent>(selectedEntity);
                                             entitySignature = ecsInterface.GetEntitySignature(selectedEntity);
@@ -2603,9 +2751,9 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(13); // If no spawner component, allow it to be added by inversing the signature
+                                inverseSignature.set(ComponentId<SpawnerComponent>); // If no spawner component, allow it to be added by inversing the signature
                             }
-                            if (entitySignature.test(14)) // UIBarComponent
+                            if (entitySignature.test(ComponentId<UIBarComponent>))
                             {
                                 if (ImGui::CollapsingHeader("UI Bar Component", ImGuiTreeNodeFlags_DefaultOpen))
                                 {
@@ -2686,7 +2834,7 @@ namespace Framework {
 
                                         // === Remove UIBarComponent ===
                                         if (ImGui::Button("Remove UI Bar Component")) {
-                                            inverseSignature.flip(14);
+                                            inverseSignature.flip(ComponentId<UIBarComponent>);
                                             undoRedoManager.PushUndoComponent(selectedEntity, barComponent);
                                             ecsInterface.RemoveComponent<UIBarComponent>(selectedEntity);
                                             entitySignature = ecsInterface.GetEntitySignature(selectedEntity);
@@ -2700,22 +2848,22 @@ namespace Framework {
                             }
                             else
                             {
-                                inverseSignature.set(14); // Allow UIBarComponent to be added when missing
+                                inverseSignature.set(ComponentId<UIBarComponent>); // Allow UIBarComponent to be added when missing
                             }
 
 
 
-                            if (inverseSignature.test(0) && ImGui::Button("Add Movement Component"))
+                            if (inverseSignature.test(ComponentId<MovementComponent>) && ImGui::Button("Add Movement Component"))
                             {
                                 ecsInterface.AddComponent<MovementComponent>(selectedEntity, MovementComponent{});
                             }
 
                             // Commenting this out here because the one below adds enemy already
-                            if (inverseSignature.test(1) && ImGui::Button("Add Enemy Component"))
+                            if (inverseSignature.test(ComponentId<EnemyComponent>) && ImGui::Button("Add Enemy Component"))
                             {
                                 ecsInterface.AddComponent<EnemyComponent>(selectedEntity, EnemyComponent{});
                             }
-                            if (inverseSignature.test(2) && ImGui::Button("Add Collision Component"))
+                            if (inverseSignature.test(ComponentId<CollisionComponent>) && ImGui::Button("Add Collision Component"))
                             {
                                 ecsInterface.AddComponent<CollisionComponent>(selectedEntity, CollisionComponent{});
                             }
@@ -2728,11 +2876,11 @@ namespace Framework {
                             //    inverseSignature.reset(2); // Update after adding the component
                             //}
 
-                            if (inverseSignature.test(3) && ImGui::Button("Add Animation Component"))
+                            if (inverseSignature.test(ComponentId<AnimationComponent>) && ImGui::Button("Add Animation Component"))
                             {
                                 std::cout << "Add Animation Component button pressed" << std::endl;
                                 ecsInterface.AddComponent<AnimationComponent>(selectedEntity, AnimationComponent{});
-                               inverseSignature.reset(3); // Update after adding the component
+                               inverseSignature.reset(ComponentId<AnimationComponent>); // Update after adding the component
                             }
 
                             /*if (inverseSignature.test(4) && ImGui::Button("Add 
@@ -2741,27 +2889,27 @@ namespace Framework {
                                 ecsInterface.AddComponent<BulletComponent>(selectedEntity, BulletComponent{});
                             }*/
 
-                            if (inverseSignature.test(5) && ImGui::Button("Add Transform Component"))
+                            if (inverseSignature.test(ComponentId<TransformComponent>) && ImGui::Button("Add Transform Component"))
                             {
                                 ecsInterface.AddComponent<TransformComponent>(selectedEntity, TransformComponent{});
                             }
 
-                            if (inverseSignature.test(6) && ImGui::Button("Add Render Component"))
+                            if (inverseSignature.test(ComponentId<RenderComponent>) && ImGui::Button("Add Render Component"))
                             {
                                 ecsInterface.AddComponent<RenderComponent>(selectedEntity, RenderComponent{});
                             }
 
-                            if (inverseSignature.test(7) && ImGui::Button("Add Layer Component"))
+                            if (inverseSignature.test(ComponentId<LayerComponent>) && ImGui::Button("Add Layer Component"))
                             {
                                 ecsInterface.AddComponent<LayerComponent>(selectedEntity, LayerComponent{});
                             }
 
-                            if (inverseSignature.test(8) && ImGui::Button("Add Text Component"))
+                            if (inverseSignature.test(ComponentId<TextComponent>) && ImGui::Button("Add Text Component"))
                             {
                                 ecsInterface.AddComponent<TextComponent>(selectedEntity, TextComponent{});
                             }
 
-                            if (inverseSignature.test(9) && ImGui::Button("Add Player Component"))
+                            if (inverseSignature.test(ComponentId<PlayerComponent>) && ImGui::Button("Add Player Component"))
                             {
                                 PlayerComponent player;
                                 player.health = 3.0;
@@ -2773,22 +2921,22 @@ namespace Framework {
                                 }
                             }
 
-                            if (inverseSignature.test(10) && ImGui::Button("Add Button Component"))
+                            if (inverseSignature.test(ComponentId<ButtonComponent>) && ImGui::Button("Add Button Component"))
                             {
                                 ecsInterface.AddComponent<ButtonComponent>(selectedEntity, ButtonComponent{});
                             }
 
-                            if (inverseSignature.test(11) && ImGui::Button("Add Timeline Component"))
+                            if (inverseSignature.test(ComponentId<TimelineComponent>) && ImGui::Button("Add Timeline Component"))
                             {
                                 ecsInterface.AddComponent<TimelineComponent>(selectedEntity, TimelineComponent{});
                             }
 
-                            if (inverseSignature.test(12) && ImGui::Button("Add Particle Component"))
+                            if (inverseSignature.test(ComponentId<ParticleComponent>) && ImGui::Button("Add Particle Component"))
                             {
                                 ecsInterface.AddComponent<ParticleComponent>(selectedEntity, ParticleComponent{});
                             }
 
-                            if (inverseSignature.test(13) && ImGui::Button("Add Spawner Component"))
+                            if (inverseSignature.test(ComponentId<SpawnerComponent>) && ImGui::Button("Add Spawner Component"))
                             {
                                 ecsInterface.AddComponent<SpawnerComponent>(selectedEntity, SpawnerComponent{});
                             }
@@ -2849,6 +2997,20 @@ namespace Framework {
                     ImGui::Text("System Performance Histogram");
                     ImGui::PlotHistogram("##SystemUsage", values.data(), static_cast<int>(values.size()), 0, nullptr, 0.0f, 100.0f, ImVec2(0, 100));
                 }
+
+                // GL call counters and live GPU resources
+                GraphicsStats::ShowImGui();
+                DynamicResolution::ShowImGui();
+                RenderTargetPool::ShowImGui();
+                TextureResidency::ShowImGui(sortedEntities);
+                ScenePreloader::ShowImGui();
+                SystemScheduler::ShowImGui();
+
+                // Capture the next frame's GL commands for Benchmarks/GLReplay
+                if (ImGui::Button("Capture GL Frame (F11)"))
+                {
+                    GLCapture::RequestCapture("GLFrame_" + std::to_string(static_cast<long long>(glfwGetTime() * 1000.0)) + ".glcap");
+                }
             }
             // End the DebugSystem ImGui window
             ImGui::End();
@@ -2912,6 +3074,7 @@ namespace Framework {
                     ecsInterface.ClearEntities(); // Clear all entity and load json to reset scene
 
                     GlobalAssetManager.UE_LoadEntities(filePath); // temporarily load this scene // cant load 
+                    SceneEvents::OnSceneLoaded(filePath);
                 }
 
                 ImGui::PopStyleColor(3); // Restore color
@@ -2956,9 +3119,14 @@ namespace Framework {
                 ImVec2 viewportMin = absoluteOffset;
                 ImVec2 viewportMax = ImVec2(absoluteOffset.x + newWidth, absoluteOffset.y + newHeight);
 
-                for (Entity entity : ecsInterface.GetEntities())
+                // Gizmos and dragging for the selected entity, submitted before the picking button so they keep mouse focus
+                static ImVec2 dragStartPos;  // Store the mouse position when drag starts
+                static glm::vec2 entityStartPos;  // Store the entity position when drag starts
+
+                if (selectedEntity != std::numeric_limits<Entity>::max() && !engineState.IsPlay()
+                    && ecsInterface.IsEntityValid(selectedEntity) && ecsInterface.HasComponent<TransformComponent>(selectedEntity))
                 {
-                    TransformComponent& transformComponent = ecsInterface.GetComponent<TransformComponent>(entity);
+                    TransformComponent& transformComponent = ecsInterface.GetComponent<TransformComponent>(selectedEntity);
 
                     ImVec2 screenMin
                     (
@@ -2972,94 +3140,120 @@ namespace Framework {
                         absoluteOffset.y + (transformComponent.position.y + transformComponent.scale.y * 0.5f) * (newHeight / projHeight)
                     );
 
-                    ImGui::SetCursorScreenPos(screenMin);
-                    ImVec2 buttonSize(screenMax.x - screenMin.x, screenMax.y - screenMin.y);
-                    std::string buttonID = "entity##" + std::to_string(entity);
-                    if (ImGui::InvisibleButton(buttonID.c_str(), buttonSize))
-                    {
-                        selectedEntity = entity;
-                        isPropertiesWindowOpen = true;
-                    }
+                    // Track interaction states
+                    static bool isScaling = false;
+                    static bool isRotating = false;
 
-                    // Track the starting drag position when the drag starts
-                    static ImVec2 dragStartPos;  // Store the mouse position when drag starts
-                    static glm::vec2 entityStartPos;  // Store the entity position when drag starts
+                    // Handle entity transformation UI next to the entity
+                    ImVec2 entityGizmoPos(screenMax.x + 10, screenMin.y); // Position UI slightly to the right
 
-                    if (selectedEntity == entity && !engineState.IsPlay())
+                    if (showGizmos == true)
                     {
-                        // Track interaction states
-                        static bool isScaling = false;
-                        static bool isRotating = false;
+                        // **Scaling Gizmo (Next to the entity)**
+                        ImGui::SetCursorScreenPos(entityGizmoPos);
+                        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(100, 0, 0, 1));
+                        ImGui::Text("Scale X/Y:");
+                        ImGui::PushItemWidth(120.0f);
+                        ImGui::SetCursorScreenPos(ImVec2(entityGizmoPos.x, entityGizmoPos.y + 20));
+                        ImGui::PushID("ScaleGizmo");  // Unique ID to avoid conflicts
+                        isScaling = ImGui::DragFloat2("##Scale", &transformComponent.scale.x, 0.5f, 0.1f, 2000.0f, "%.2f");
+                        ImGui::PopID();
+                        ImGui::PopItemWidth();
 
-                        // Handle entity transformation UI next to the entity
-                        ImVec2 entityGizmoPos(screenMax.x + 10, screenMin.y); // Position UI slightly to the right
+                        // **Rotation Gizmo (Below the Scale UI)**
+                        ImVec2 rotationGizmoPos(entityGizmoPos.x, entityGizmoPos.y + 50); // Offset below scale UI
+                        ImGui::SetCursorScreenPos(rotationGizmoPos);
+                        ImGui::Text("Rotation:");
+                        ImGui::PushItemWidth(120.0f);
+                        ImGui::SetCursorScreenPos(ImVec2(rotationGizmoPos.x, rotationGizmoPos.y + 20));
 
-                        if (showGizmos == true)
-                        {
-                            // **Scaling Gizmo (Next to the entity)**
-                            ImGui::SetCursorScreenPos(entityGizmoPos);
-                            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(100, 0, 0, 1));
-                            ImGui::Text("Scale X/Y:");
-                            ImGui::PushItemWidth(120.0f);
-                            ImGui::SetCursorScreenPos(ImVec2(entityGizmoPos.x, entityGizmoPos.y + 20));
-                            ImGui::PushID("ScaleGizmo");  // Unique ID to avoid conflicts
-                            isScaling = ImGui::DragFloat2("##Scale", &transformComponent.scale.x, 0.5f, 0.1f, 2000.0f, "%.2f");
-                            ImGui::PopID();
-                            ImGui::PopItemWidth();
-
-                            // **Rotation Gizmo (Below the Scale UI)**
-                            ImVec2 rotationGizmoPos(entityGizmoPos.x, entityGizmoPos.y + 50); // Offset below scale UI
-                            ImGui::SetCursorScreenPos(rotationGizmoPos);
-                            ImGui::Text("Rotation:");
-                            ImGui::PushItemWidth(120.0f);
-                            ImGui::SetCursorScreenPos(ImVec2(rotationGizmoPos.x, rotationGizmoPos.y + 20));
-
-                            ImGui::PushID("RotationGizmo");  // Unique ID for rotation gizmo
-                            isRotating = ImGui::DragFloat("##Rotation", &transformComponent.rotation, 0.5f, -720.0f, 720.0f, "%.1f deg");
-                            ImGui::PopID();
-                            ImGui::PopItemWidth();
-                            // Reset to default color after the text
-                            ImGui::PopStyleColor();
-                        }
+                        ImGui::PushID("RotationGizmo");  // Unique ID for rotation gizmo
+                        isRotating = ImGui::DragFloat("##Rotation", &transformComponent.rotation, 0.5f, -720.0f, 720.0f, "%.1f deg");
+                        ImGui::PopID();
+                        ImGui::PopItemWidth();
+                        // Reset to default color after the text
+                        ImGui::PopStyleColor();
+                    }
 
-                        // **Translation Logic** (if not scaling or rotating)
-                        if (ImGui::IsMouseDown(0) && !ImGui::IsMouseDragging(0) && !Graphics::IsMouseOutsideViewport(viewportMin, viewportMax) && showGizmos == false)
-                        {
-                            // Optional: Debug Bounding Boxes
-                            auto* drawList = ImGui::GetWindowDrawList();
-                            drawList->AddRect(screenMin, screenMax, IM_COL32(70, 200, 70, 255)); // Green bounding box for debugging
-
-                            // Capture the starting mouse position and entity position at the beginning of the drag
-                            ImVec2 mousePos = ImGui::GetMousePos();
-                            dragStartPos = mousePos;
-                            entityStartPos = transformComponent.position;
-                        }
+                    // **Translation Logic** (if not scaling or rotating)
+                    if (ImGui::IsMouseDown(0) && !ImGui::IsMouseDragging(0) && !Graphics::IsMouseOutsideViewport(viewportMin, viewportMax) && showGizmos == false)
+                    {
+                        // Optional: Debug Bounding Boxes
+                        auto* drawList = ImGui::GetWindowDrawList();
+                        drawList->AddRect(screenMin, screenMax, IM_COL32(70, 200, 70, 255)); // Green bounding box for debugging
+
+                        // Capture the starting mouse position and entity position at the beginning of the drag
+                        ImVec2 mousePos = ImGui::GetMousePos();
+                        dragStartPos = mousePos;
+                        entityStartPos = transformComponent.position;
+                    }
 
-                        if (ImGui::IsMouseDragging(0) && !Graphics::IsMouseOutsideViewport(viewportMin, viewportMax) && showGizmos == false)
-                        {
-                            // Optional: Debug Bounding Boxes
-                            auto* drawList = ImGui::GetWindowDrawList();
-                            drawList->AddRect(screenMin, screenMax, IM_COL32(70, 200, 70, 255)); // Green bounding box for debugging
+                    if (ImGui::IsMouseDragging(0) && !Graphics::IsMouseOutsideViewport(viewportMin, viewportMax) && showGizmos == false)
+                    {
+                        // Optional: Debug Bounding Boxes
+                        auto* drawList = ImGui::GetWindowDrawList();
+                        drawList->AddRect(screenMin, screenMax, IM_COL32(70, 200, 70, 255)); // Green bounding box for debugging
 
-                            // Get the current mouse position
-                            ImVec2 mousePos = ImGui::GetMousePos();
+                        // Get the current mouse position
+                        ImVec2 mousePos = ImGui::GetMousePos();
 
-                            // Calculate the mouse delta (difference from the start position)
-                            ImVec2 mouseDelta = ImVec2(mousePos.x - dragStartPos.x, mousePos.y - dragStartPos.y);
+                        // Calculate the mouse delta (difference from the start position)
+                        ImVec2 mouseDelta = ImVec2(mousePos.x - dragStartPos.x, mousePos.y - dragStartPos.y);
 
-                            // Convert from screen space to world space based on the current scale
-                            float dragX = (mouseDelta.x / newWidth) * projWidth;
-                            float dragY = (mouseDelta.y / newHeight) * projHeight;
+                        // Convert from screen space to world space based on the current scale
+                        float dragX = (mouseDelta.x / newWidth) * projWidth;
+                        float dragY = (mouseDelta.y / newHeight) * projHeight;
 
-                            // Update the entity's position based on the drag
-                            transformComponent.position.x = entityStartPos.x + dragX;
-                            transformComponent.position.y = entityStartPos.y + dragY;
-                        }
+                        // Update the entity's position based on the drag
+                        transformComponent.position.x = entityStartPos.x + dragX;
+                        transformComponent.position.y = entityStartPos.y + dragY;
+                        MarkSceneDirty();
+                    }
+                }
+
+                // One button over the whole image replaces the per-entity buttons, the ID buffer decides what is under the cursor
+                ImGui::SetCursorScreenPos(viewportMin);
+                ImGui::InvisibleButton("##ViewportPicking", ImVec2(newWidth, newHeight));
+                if (ImGui::IsItemHovered() && newWidth > 0.0f && newHeight > 0.0f)
+                {
+                    bool clicked = ImGui::IsMouseClicked(0);
+                    ImVec2 mouseDelta = ImGui::GetIO().MouseDelta;
+                    if (clicked || mouseDelta.x != 0.0f || mouseDelta.y != 0.0f)
+                    {
+                        // Screen space to game framebuffer pixels (framebuffer origin is bottom-left)
+                        ImVec2 mousePos = ImGui::GetMousePos();
+                        int pixelX = static_cast<int>((mousePos.x - viewportMin.x) * (projWidth / newWidth));
+                        int pixelY = static_cast<int>(projHeight) - 1 - static_cast<int>((mousePos.y - viewportMin.y) * (projHeight / newHeight));
+                        GraphicsPicking::RequestPick(pixelX, pixelY, clicked);
                     }
                 }
+
+                // Click results arrive a frame or two later, empty space keeps the current selection
+                Entity pickedEntity;
+                if (GraphicsPicking::ConsumeClick(pickedEntity) && pickedEntity != GraphicsPicking::NoEntity)
+                {
+                    if (pickedEntity != selectedEntity && ecsInterface.HasComponent<TransformComponent>(pickedEntity))
+                    {
+                        // Restart the drag from the newly picked entity, not the one selected when the mouse went down
+                        dragStartPos = ImGui::GetMousePos();
+                        entityStartPos = ecsInterface.GetComponent<TransformComponent>(pickedEntity).position;
+                    }
+                    selectedEntity = pickedEntity;
+                    isPropertiesWindowOpen = true;
+                }
             }
             ImGui::End();
 
+            // Widget edits, gizmo drags and asset panel changes all go through an active ImGui item.
+            // The frame after an item is released is rendered too, so the final value is shown.
+            static bool wasAnyItemActive = false;
+            bool isAnyItemActive = ImGui::IsAnyItemActive();
+            if (isAnyItemActive || wasAnyItemActive)
+            {
+                MarkSceneDirty();
+            }
+            wasAnyItemActive = isAnyItemActive;
+
             // Render ImGui
             ImGui::Render();
             ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
@@ -3071,11 +3265,17 @@ namespace Framework {
             glfwMakeContextCurrent(backup_current_context);
             glfwSetDropCallback(backup_current_context, DropCallback);
 
+            if (ImGui::IsKeyPressed(ImGuiKey_F11, false))                        // Handle key press for GL frame capture (F11)
+            {
+                GLCapture::RequestCapture("GLFrame_" + std::to_string(static_cast<long long>(glfwGetTime() * 1000.0)) + ".glcap");
+            }
             if (ImGui::IsKeyPressed(ImGuiKey_Z) && ImGui::GetIO().KeyCtrl)      // Handle key press for Undo (Ctrl+Z)
             {
                 if (undoRedoManager.CanUndo())
                 {
                     undoRedoManager.Undo(); // Perform undo action
+                    MarkSceneDirty();
+                    TimelineSystem::TimelineTagsEdited();   // The action may have been a TimelineTag edit
                     std::cout << "After Undo:" << std::endl;
                     undoRedoManager.PrintStackDetails(); // Print undo stack details
                 }
@@ -3085,11 +3285,18 @@ namespace Framework {
                 if (undoRedoManager.CanRedo())
                 {
                     undoRedoManager.Redo(); // Perform redo action
+                    MarkSceneDirty();
+                    TimelineSystem::TimelineTagsEdited();   // The action may have been a TimelineTag edit
                     std::cout << "After Redo:" << std::endl;
                     undoRedoManager.PrintStackDetails(); // Print redo stack details
                 }
             }
         }
+
+        RenderTargetPool::EndFrame();
+        TextureResidency::EndFrame(sortedEntities);
+        ScenePreloader::EndFrame();
+        GraphicsStats::EndFrame();
     }
 
     // Get the name of the system
@@ -3098,6 +3305,28 @@ namespace Framework {
         return "Graphics";
     }
 
+    // Render order of two entities: LayerID, then SortID, then Entity ID
+    bool Graphics::CompareRenderOrder(Entity a, Entity b)
+    {
+        return CompareRenderOrder(ecsInterface.GetComponent<LayerComponent>(a), a, ecsInterface.GetComponent<LayerComponent>(b), b);
+    }
+
+    bool Graphics::CompareRenderOrder(const LayerComponent& layerA, Entity a, const LayerComponent& layerB, Entity b)
+    {
+        // First, compare LayerID
+        if (layerA.layerID != layerB.layerID) {
+            return layerA.layerID < layerB.layerID;
+        }
+
+        // If LayerID is the same, compare SortID
+        if (layerA.sortID != layerB.sortID) {
+            return layerA.sortID < layerB.sortID;
+        }
+
+        // If both LayerID and SortID are the same, fall back to Entity ID
+        return a < b;
+    }
+
     /* @ SETTING BACKGROUND COLOR */
     void Graphics::SetBackgroundColor(int r, int g, int b, GLclampf alpha)
     {
@@ -3117,6 +3346,7 @@ namespace Framework {
         //start shader program
         shdr_pgm.Use();
         glBindVertexArray(vaoid);
+        GLCapture::RecordBindVertexArray(vaoid);
 
         // Checking if texture is being used to draw
         bool useTexture = (textureID != 0);
@@ -3125,11 +3355,17 @@ namespace Framework {
         if (useTexture)
         {
             glBindTexture(GL_TEXTURE_2D, textureID);
+            GraphicsStats::Count(GLCallCategory::TextureBind);
+            GLCapture::RecordBindTexture(textureID);
+
+            // Filtering and clamping come from the shared sampler, set once per change instead of per draw
+            GraphicsTextures::BindSampler(sampler);
         }
 
         // Set the texture usage flag in the shader
         GLuint useTextureLocation = glGetUniformLocation(shdr_pgm.GetHandle(), "useTexture");
         glUniform1i(useTextureLocation, useTexture);
+        GLCapture::RecordUniform1i(shdr_pgm.GetHandle(), "useTexture", useTexture);
 
         // Set the color uniform in the shader
         GLuint colorLocation = glGetUniformLocation(shdr_pgm.GetHandle(), "uColor");
@@ -3139,45 +3375,71 @@ namespace Framework {
         // Setting color and alpha
         glUniform3f(colorLocation, color.r, color.g, color.b);
         glUniform1f(alphaLocation, alpha);
+        GLCapture::RecordUniform3f(shdr_pgm.GetHandle(), "uColor", color.r, color.g, color.b);
+        GLCapture::RecordUniform1f(shdr_pgm.GetHandle(), "uAlpha", alpha);
+
+        // Cooked textures store colour premultiplied by alpha, the shader scales it and blending adds it as is
+        bool premultiplied = useTexture && premultipliedAlpha;
+        GLint premultipliedLocation = glGetUniformLocation(shdr_pgm.GetHandle(), "uPremultiplied");
+        glUniform1i(premultipliedLocation, premultiplied);
+        GLCapture::RecordUniform1i(shdr_pgm.GetHandle(), "uPremultiplied", premultiplied);
 
         //for transparent background while loading PNG images
+        GLenum srcFactor = premultiplied ? GL_ONE : GL_SRC_ALPHA;
         glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        //clamping of textures
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBlendFunc(srcFactor, GL_ONE_MINUS_SRC_ALPHA);
+        GraphicsStats::Count(GLCallCategory::StateChange, 2);
+        GLCapture::RecordEnable(GL_BLEND);
+        GLCapture::RecordBlendFunc(srcFactor, GL_ONE_MINUS_SRC_ALPHA);
 
         // Setting matrix transform for Vertex File
         glUniformMatrix4fv(glGetUniformLocation(shdr_pgm.GetHandle(), "modelMatrix"), 1, GL_FALSE, glm::value_ptr(modelMatrix));
         glUniformMatrix4fv(glGetUniformLocation(shdr_pgm.GetHandle(), "viewMatrix"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
         glUniformMatrix4fv(glGetUniformLocation(shdr_pgm.GetHandle(), "projectionMatrix"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+        GraphicsStats::Count(GLCallCategory::UniformUpload, 7);
+        GLCapture::RecordUniformMatrix4f(shdr_pgm.GetHandle(), "modelMatrix", glm::value_ptr(modelMatrix));
+        GLCapture::RecordUniformMatrix4f(shdr_pgm.GetHandle(), "viewMatrix", glm::value_ptr(viewMatrix));
+        GLCapture::RecordUniformMatrix4f(shdr_pgm.GetHandle(), "projectionMatrix", glm::value_ptr(projectionMatrix));
 
         //for changing of primitive_type when drawing objects;
+        GraphicsStats::Count(GLCallCategory::DrawCall);
         switch (primitive_type)
         {
         case GL_POINTS:
             glPointSize(10.f);
             glDrawArrays(primitive_type, 0, draw_cnt);
+            GLCapture::RecordPointSize(10.f);
+            GLCapture::RecordDrawArrays(primitive_type, 0, draw_cnt);
             break;
 
         case GL_LINES:
             glLineWidth(3.f);
             glDrawArrays(primitive_type, 0, draw_cnt);
             glLineWidth(1.f);
+            GLCapture::RecordLineWidth(3.f);
+            GLCapture::RecordDrawArrays(primitive_type, 0, draw_cnt);
+            GLCapture::RecordLineWidth(1.f);
             break;
 
         case GL_TRIANGLE_FAN:
             glDrawArrays(primitive_type, 0, draw_cnt);
+            GLCapture::RecordDrawArrays(primitive_type, 0, draw_cnt);
             break;
 
         case GL_TRIANGLES:
             glDrawElements(primitive_type, draw_cnt, GL_UNSIGNED_INT, 0);
+            GLCapture::RecordDrawElements(primitive_type, draw_cnt);
             break;
         }
 
+        // Text and ImGui draw after sprites and expect straight alpha blending
+        if (premultiplied)
+        {
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            GraphicsStats::Count(GLCallCategory::StateChange);
+            GLCapture::RecordBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        }
+
         glBindVertexArray(0);
         shdr_pgm.UnUse();
     }
@@ -3192,6 +3454,7 @@ namespace Framework {
 
         glCreateBuffers(1, &mdl.vbo_hdl);
         glNamedBufferStorage(mdl.vbo_hdl, sizeof(glm::vec2), &pos_vtx, GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.vbo_hdl, sizeof(glm::vec2));
 
         glCreateVertexArrays(1, &mdl.vaoid);
         glEnableVertexArrayAttrib(mdl.vaoid, 0);
@@ -3229,6 +3492,7 @@ namespace Framework {
 
         glCreateBuffers(1, &mdl.vbo_hdl);
         glNamedBufferStorage(mdl.vbo_hdl, sizeof(glm::vec2) * pos_vtx.size(), pos_vtx.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.vbo_hdl, sizeof(glm::vec2) * pos_vtx.size());
 
 
         glCreateVertexArrays(1, &mdl.vaoid);
@@ -3277,6 +3541,7 @@ namespace Framework {
 
         glCreateBuffers(1, &mdl.vbo_hdl);
         glNamedBufferStorage(mdl.vbo_hdl, sizeof(glm::vec2) * pos_vtx.size(), pos_vtx.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.vbo_hdl, sizeof(glm::vec2) * pos_vtx.size());
 
         glCreateVertexArrays(1, &mdl.vaoid);
         glEnableVertexArrayAttrib(mdl.vaoid, 0);
@@ -3325,10 +3590,12 @@ namespace Framework {
 
         glCreateBuffers(1, &mdl.ebo_hdl);
         glNamedBufferStorage(mdl.ebo_hdl, sizeof(GLuint) * indices.size(), indices.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.ebo_hdl, sizeof(GLuint) * indices.size());
 
 
         glCreateBuffers(1, &mdl.vbo_hdl);
         glNamedBufferStorage(mdl.vbo_hdl, sizeof(glm::vec2) * pos_vtx.size(), pos_vtx.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.vbo_hdl, sizeof(glm::vec2) * pos_vtx.size());
 
 
         // Bind the position buffer
@@ -3364,7 +3631,8 @@ namespace Framework {
         const std::string& meshName,
         const std::string& textureName) // Add texture path
     {
-        GLuint textureID = GlobalAssetManager.UE_LoadTextureToOpenGL(textureName);
+        GLuint textureID = GetTexture(textureName);
+        TextureResidency::Pin(textureName); // Default texture of a shared mesh, never evicted
         
         std::vector<GLuint> indices = { 0, 1, 2, 2, 3, 0 };
 
@@ -3374,12 +3642,15 @@ namespace Framework {
 
         glCreateBuffers(1, &mdl.vbo_hdl);
         glNamedBufferStorage(mdl.vbo_hdl, sizeof(glm::vec2) * vtx_coord.size(), vtx_coord.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.vbo_hdl, sizeof(glm::vec2) * vtx_coord.size());
 
         glCreateBuffers(1, &mdl.tex_vbo_hdl);
         glNamedBufferStorage(mdl.tex_vbo_hdl, sizeof(glm::vec2) * txt_coords.size(), txt_coords.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.tex_vbo_hdl, sizeof(glm::vec2) * txt_coords.size());
 
         glCreateBuffers(1, &mdl.ebo_hdl);
         glNamedBufferStorage(mdl.ebo_hdl, sizeof(GLuint) * indices.size(), indices.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(mdl.ebo_hdl, sizeof(GLuint) * indices.size());
 
         glCreateVertexArrays(1, &mdl.vaoid);
 
@@ -3403,6 +3674,7 @@ namespace Framework {
         mdl.setup_shdrpgm(UE_vs, UE_fs);
         mdl.color = clr_vtx;
         mdl.textureID = textureID; // Store the texture ID in the model
+        mdl.premultipliedAlpha = TextureResidency::IsPremultiplied(TextureResidency::Resolve(textureName));
         mdl.primitive_type = GL_TRIANGLES;
         mdl.draw_cnt = static_cast<GLuint>(indices.size());
         mdl.primitive_cnt = mdl.draw_cnt / 3;
@@ -3424,6 +3696,11 @@ namespace Framework {
         return meshes[name];  // Ensure that the mesh exists
     }
 
+    GLuint Graphics::GetTexture(const std::string& name)
+    {
+        return TextureResidency::Acquire(name);
+    }
+
     //  Mesh //
     // Integrated texture coordinate update for animation
     void Graphics::drawMeshWithAnimation(Graphics::Model& mdl, int currFrame, int cols, int rows)
@@ -3435,10 +3712,15 @@ namespace Framework {
         float frameWidth = 1.0f / cols;
         float frameHeight = 1.0f / rows;
 
-        float u_min = col * frameWidth;
-        float v_min = row * frameHeight;
-        float u_max = u_min + frameWidth;
-        float v_max = v_min + frameHeight;
+        drawMeshWithAnimation(mdl, glm::vec4(col * frameWidth, row * frameHeight, frameWidth, frameHeight));
+    }
+
+    void Graphics::drawMeshWithAnimation(Graphics::Model& mdl, const glm::vec4& uvRect)
+    {
+        float u_min = uvRect.x;
+        float v_min = uvRect.y;
+        float u_max = u_min + uvRect.z;
+        float v_max = v_min + uvRect.w;
 
         // Update the texture coordinates dynamically for the frame
         std::vector<glm::vec2> txt_coords = {
@@ -3452,11 +3734,14 @@ namespace Framework {
         GLuint tex_vbo_hdl;
         glCreateBuffers(1, &tex_vbo_hdl);
         glNamedBufferStorage(tex_vbo_hdl, sizeof(glm::vec2) * txt_coords.size(), txt_coords.data(), GL_DYNAMIC_STORAGE_BIT);
+        GraphicsStats::TrackBuffer(tex_vbo_hdl, sizeof(glm::vec2) * txt_coords.size());
 
         glEnableVertexArrayAttrib(mdl.vaoid, 1);
         glVertexArrayVertexBuffer(mdl.vaoid, 1, tex_vbo_hdl, 0, sizeof(glm::vec2));
         glVertexArrayAttribFormat(mdl.vaoid, 1, 2, GL_FLOAT, GL_FALSE, 0);
         glVertexArrayAttribBinding(mdl.vaoid, 1, 1);
+        GLCapture::RecordBufferData(tex_vbo_hdl, txt_coords.data(), sizeof(glm::vec2) * txt_coords.size());
+        GLCapture::RecordVertexArrayVertexBuffer(mdl.vaoid, 1, tex_vbo_hdl, 0, sizeof(glm::vec2));
 
         // Bind and draw the mesh as usual
         glBindVertexArray(mdl.vaoid);
@@ -3464,6 +3749,7 @@ namespace Framework {
 
         // Cleanup the buffer
         glDeleteBuffers(1, &tex_vbo_hdl);
+        GraphicsStats::UntrackBuffer(tex_vbo_hdl);
         mdl.primitive_type = GL_TRIANGLES;
     }
 
@@ -3481,13 +3767,9 @@ namespace Framework {
 
         Graphics::Model& model = getMesh("sprite"); // Use for mesh
 
-        // Loads the texture if it�s not loaded into map
-        if (textures.find("Hitbox") == textures.end())
-        {
-            textures["Hitbox"] = GlobalAssetManager.UE_LoadTextureToOpenGL("Hitbox");
-        }
-
-        model.textureID = textures["Hitbox"]; // Assign loaded texture ID to model
+        static TextureBinding hitboxBinding;
+        model.textureID = hitboxBinding.Get("Hitbox"); // Assign loaded texture ID to model
+        model.premultipliedAlpha = hitboxBinding.IsPremultiplied();
 
         // TRANSLATE, ROTATE, SCALE
         glm::vec2 translation(center.x, center.y);
@@ -3547,6 +3829,7 @@ namespace Framework {
         glGenTextures(1, &texture);
         glBindTexture(GL_TEXTURE_2D, texture);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+        GraphicsStats::TrackTexture(texture, static_cast<std::size_t>(width) * height * 3);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
@@ -3574,6 +3857,7 @@ namespace Framework {
     //FILE OPENING / SAVING
     std::string Graphics::OpenFileDialog()
     {
+#ifdef _WIN32
         OPENFILENAMEA ofn;
         char szFile[260] = { 0 };
 
@@ -3610,11 +3894,14 @@ namespace Framework {
                 return fullPath;
             }
         }
+#endif
+        // No native file dialog off Windows, callers treat an empty path as cancelled
         return "";
     }
 
     std::string Graphics::SaveFileDialog()
     {
+#ifdef _WIN32
         OPENFILENAMEA ofn;
         char szFile[260] = { 0 };
         ZeroMemory(&ofn, sizeof(ofn));
@@ -3643,6 +3930,7 @@ namespace Framework {
             }
             return fullPath;
         }
+#endif
         return "";
     }
 
@@ -3670,6 +3958,7 @@ namespace Framework {
     void Graphics::DropCallback(GLFWwindow* window, int count, const char** paths)
     {
         (void)window;
+        MarkSceneDirty();
         for (int i = 0; i < count; i++) 
         {
             std::string callbackFilePath = paths[i];
@@ -3723,15 +4012,27 @@ namespace Framework {
     // Get the current working directory
     std::wstring Graphics::GetCurrentWorkingDirectory()
     {
+#ifdef _WIN32
         wchar_t buffer[MAX_PATH];
         GetCurrentDirectory(MAX_PATH, buffer);
         return std::wstring(buffer);
+#else
+        std::error_code error;
+        return std::filesystem::current_path(error).wstring();
+#endif
     }
 
     // Change the current working directory
     void Graphics::ChangeWorkingDirectory(const std::wstring& newDirectory)
     {
-        if (SetCurrentDirectory(newDirectory.c_str()) == 0)
+#ifdef _WIN32
+        bool changed = SetCurrentDirectory(newDirectory.c_str()) != 0;
+#else
+        std::error_code error;
+        std::filesystem::current_path(std::filesystem::path(newDirectory), error);
+        bool changed = !error;
+#endif
+        if (!changed)
         {
             std::wcerr << L"Failed to change directory to: " << newDirectory << std::endl;
         }
@@ -3840,16 +4141,19 @@ namespace Framework {
     void Graphics::Camera::move(const glm::vec2& delta)
     {
         position += delta; // Update camera position
+        MarkSceneDirty();
     }
 
     void Graphics::Camera::setZoom(float newZoom)
     {
         zoom = newZoom;
+        MarkSceneDirty();
     }
 
     void Graphics::Camera::setPosition(const glm::vec2& newPosition)
     {
         position = newPosition;
+        MarkSceneDirty();
     }
 
     // CLEANING AND FREE-ING OF MEMORY //
@@ -3866,6 +4170,7 @@ namespace Framework {
         if (vbo_hdl != 0)
         {
             glDeleteBuffers(1, &vbo_hdl);
+            GraphicsStats::UntrackBuffer(vbo_hdl);
             vbo_hdl = 0;
         }
 
@@ -3873,6 +4178,7 @@ namespace Framework {
         if (ebo_hdl != 0)
         {
             glDeleteBuffers(1, &ebo_hdl);
+            GraphicsStats::UntrackBuffer(ebo_hdl);
             ebo_hdl = 0;
         }
 
@@ -3880,6 +4186,7 @@ namespace Framework {
         if (tex_vbo_hdl != 0)
         {
             glDeleteBuffers(1, &tex_vbo_hdl);
+            GraphicsStats::UntrackBuffer(tex_vbo_hdl);
             tex_vbo_hdl = 0;
         }
 
@@ -3887,6 +4194,7 @@ namespace Framework {
         if (textureID != 0)
         {
             glDeleteTextures(1, &textureID);
+            GraphicsStats::UntrackTexture(textureID);
             textureID = 0;
         }
 
@@ -3903,8 +4211,9 @@ namespace Framework {
 
     void AssignTag(Framework::Entity entityID, std::string Tag) {
         //brute force tag for animation once per entity
-        if (!ecsInterface.HasTag(entityID, Tag)) {
-            ecsInterface.AddTag(entityID, Tag);
+        TagId tag = TagIndex::Intern(Tag);
+        if (!TagIndex::Has(entityID, tag)) {
+            TagIndex::Add(entityID, tag);
             std::cout << "Added tag" << Tag;
         }
     }
@@ -3928,6 +4237,7 @@ namespace Framework {
 
     void Graphics::RenderFPS(float projWidth, float projHeight) {
         // Set active font (assuming you have a default font)
+        GraphicsTextures::UnbindSampler();
         fontSystem.SetActiveFont("Salmon"); // Change to your actual font
 
         // Position for displaying FPS (e.g., top-left corner)
@@ -3941,6 +4251,13 @@ namespace Framework {
 
         // Render the text
         fontSystem.RenderText(fpsText, textPosition.x, textPosition.y, 1, glm::vec3(1.0f, 0.0f, 0.0f), projection);
+        GraphicsStats::CountText(fpsText.size());
+
+        // Dynamic resolution scale below it, a low FPS reads differently at 50% than at native resolution
+        int scalePercent = static_cast<int>(DynamicResolution::GetScale() * 100.0f + 0.5f);
+        std::string scaleText = "Render scale: " + std::to_string(scalePercent) + "%" + (DynamicResolution::IsLocked() ? " (locked)" : "");
+        fontSystem.RenderText(scaleText, textPosition.x, textPosition.y + 50.f, 1, glm::vec3(1.0f, 0.0f, 0.0f), projection);
+        GraphicsStats::CountText(scaleText.size());
     }
 
     //// IMGUI BELOW
@@ -4004,6 +4321,7 @@ namespace Framework {
                         ecsInterface.ClearEntities();
                         entityAssets.clear();
                         GlobalAssetManager.UE_LoadEntities(filePath);
+                        SceneEvents::OnSceneLoaded(filePath);
 
                         // Revert to the directory two levels above the original directory
                         std::wstring parentDir = Graphics::ExtractParentDirectory(originalDir, 2);
@@ -29,11 +29,13 @@
 #include "System.h"
 #include "GraphicsWindows.h"
 #include <GraphicsShader.h>
+#include "GraphicsTextures.h"
 #include <InputHandler.h>
 #include <PhysicsSystem.h>
 #include <FontSystem.h>
 #include "AssetManager.h"
 #include <ComponentList.h>
+#include "SystemScheduler.h"
 #include "imgui.h"
 
 namespace Framework {
@@ -41,6 +43,13 @@ namespace Framework {
 	class Graphics : public ISystem
 	{
 	public:
+		// Everything drawn is read, win/lose screens toggle RenderComponent::isActive; GL needs the main thread.
+		// Update also runs the editor, which edits any component and creates and destroys entities, so it runs alone
+		static constexpr SystemAccess Access{
+			SignatureOf<TransformComponent, LayerComponent, AnimationComponent, UIBarComponent, TextComponent, CollisionComponent>,
+			SignatureOf<RenderComponent>,
+			SystemMainThread | SystemExclusive };
+
 		Graphics(GraphicsWindows* graphicWindows);
 		~Graphics();
 
@@ -90,6 +99,8 @@ namespace Framework {
 				glm::vec3 color{};
 				float alpha{};
 				GLuint textureID{};
+				SamplerType sampler = SamplerType::LinearMipmapClamp; // Shared sampler used when textured
+				bool premultipliedAlpha = false; // Texture is cooked with premultiplied colour
 				glm::mat4 modelMatrix{};
 				glm::mat4 viewMatrix{};
 				glm::mat4 projectionMatrix{};
@@ -155,7 +166,7 @@ namespace Framework {
 		static Camera camera;
 
 		//creating frame buffer for imGUI
-		static GLuint gameFramebuffer, gameTexture, rbo, pickingFBO;
+		static GLuint gameFramebuffer, gameTexture, rbo;
 		static unsigned char* data;
 		static float projHeight;
 		static float projWidth;
@@ -272,6 +283,18 @@ namespace Framework {
 		 */
 		static Graphics::Model& getMesh(const std::string& name);
 
+		/**
+		 * @brief Retrieves a texture by asset name, loading it on first use.
+		 *
+		 * Loaded textures get a mip chain once and stay resident in TextureResidency
+		 * until they are evicted to meet the VRAM budget.
+		 *
+		 * @param name : texture asset name, as stored in RenderComponent::textureID.
+		 *
+		 * @return the GL texture, or 0 if the asset could not be loaded.
+		 */
+		static GLuint GetTexture(const std::string& name);
+
 
 		/**
 		 * @brief Drawing meshes with animation spritesheet
@@ -285,6 +308,13 @@ namespace Framework {
 		 */
 		static void drawMeshWithAnimation(Graphics::Model& mdl, int currentFrame, int cols, int rows);
 
+		/**
+		 * @brief Drawing meshes with one rect of a texture, e.g. a trimmed frame from SpriteFrames
+		 *
+		 * @param uvRect : u, v, width, height of the rect in the texture
+		 */
+		static void drawMeshWithAnimation(Graphics::Model& mdl, const glm::vec4& uvRect);
+
 		/**
 		 * @brief Calculate 2D Transformation With Scale, Rotate and Translate;
 		 *
@@ -296,6 +326,29 @@ namespace Framework {
 		 */
 		static glm::mat4 calculate2DTransform(const glm::vec2& translation, float rotation, const glm::vec2& scale);
 
+		/**
+		 * @brief Sorting comparator for renderable entities.
+		 *
+		 * Orders by LayerComponent layerID, then sortID, then entity ID.
+		 *
+		 * @param [Entity] a first entity.
+		 * @param [Entity] b second entity.
+		 */
+		static bool CompareRenderOrder(Entity a, Entity b);
+
+		// CompareRenderOrder on layer components already fetched
+		static bool CompareRenderOrder(const LayerComponent& layerA, Entity a, const LayerComponent& layerB, Entity b);
+
+		/**
+		 * @brief Flags the editor viewport for a re-render.
+		 *
+		 * Outside running play mode gameFramebuffer is only redrawn when the scene changed.
+		 * Call after changing anything that is visible in the scene from outside the editor panels;
+		 * scene loads (SceneEvents), texture uploads (TextureResidency) and play ticks while paused
+		 * (TimelineSystem) already do.
+		 */
+		static void MarkSceneDirty();
+
 
 		/*
 		@brief Setting Background Color
@@ -317,6 +370,12 @@ namespace Framework {
 		//imgui
 		void showImGUI();
 		static bool toggleImGUI;
+
+	private:
+		// Render on demand
+		bool NeedsSceneRender() const;
+		void RenderScene();
+		static bool sceneDirty;
 	};
 }
 #endif // !_GRAPHICS_H_
\ No newline at end of file
@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GraphicsPicking.cpp
+///
+/// @brief ID-buffer picking for the editor viewport. Entities are drawn with
+///        the same transforms, textures and sprite-sheet frames as the scene,
+///        so rotation and transparent texels are respected.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "GraphicsPicking.h"
+#include "Graphics.h"
+#include "AnimationPlayback.h"
+#include "Coordinator.h"
+#include "EngineState.h"
+#include "GraphicsStats.h"
+#include "RenderTargetPool.h"
+#include "SpriteFrames.h"
+#include <algorithm>
+#include <iostream>
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+	UE_Shader GraphicsPicking::shader{};
+	std::array<GraphicsPicking::Readback, GraphicsPicking::ReadbackSlots> GraphicsPicking::readbacks{};
+	std::size_t GraphicsPicking::nextSlot{};
+	bool GraphicsPicking::pickRequested{};
+	bool GraphicsPicking::requestIsClick{};
+	int GraphicsPicking::requestX{};
+	int GraphicsPicking::requestY{};
+	Entity GraphicsPicking::hoveredEntity = GraphicsPicking::NoEntity;
+	Entity GraphicsPicking::clickedEntity = GraphicsPicking::NoEntity;
+	bool GraphicsPicking::hasClickResult{};
+	GLint GraphicsPicking::modelMatrixLocation{}, GraphicsPicking::viewMatrixLocation{}, GraphicsPicking::projectionMatrixLocation{};
+	GLint GraphicsPicking::entityIDLocation{}, GraphicsPicking::useTextureLocation{}, GraphicsPicking::alphaLocation{}, GraphicsPicking::uvRectLocation{};
+
+	void GraphicsPicking::Initialize(std::string const& vertexShader, std::string const& fragmentShader)
+	{
+		if (!shader.CompileLinkValidate({ { GL_VERTEX_SHADER, vertexShader }, { GL_FRAGMENT_SHADER, fragmentShader } }))
+		{
+			std::cout << "Picking shader failed to build: " << shader.GetLog() << std::endl;
+			return;
+		}
+
+		modelMatrixLocation = glGetUniformLocation(shader.GetHandle(), "modelMatrix");
+		viewMatrixLocation = glGetUniformLocation(shader.GetHandle(), "viewMatrix");
+		projectionMatrixLocation = glGetUniformLocation(shader.GetHandle(), "projectionMatrix");
+		entityIDLocation = glGetUniformLocation(shader.GetHandle(), "entityID");
+		useTextureLocation = glGetUniformLocation(shader.GetHandle(), "useTexture");
+		alphaLocation = glGetUniformLocation(shader.GetHandle(), "uAlpha");
+		uvRectLocation = glGetUniformLocation(shader.GetHandle(), "uUVRect");
+
+		// One RGBA8 pixel per readback
+		for (Readback& readback : readbacks)
+		{
+			glCreateBuffers(1, &readback.pbo);
+			glNamedBufferStorage(readback.pbo, 4, nullptr, GL_CLIENT_STORAGE_BIT);
+			GraphicsStats::TrackBuffer(readback.pbo, 4);
+		}
+	}
+
+	void GraphicsPicking::RequestPick(int x, int y, bool isClick)
+	{
+		requestX = x;
+		requestY = y;
+
+		// A click is never downgraded by a later hover in the same frame
+		requestIsClick = requestIsClick || isClick;
+		pickRequested = true;
+	}
+
+	void GraphicsPicking::Update(const std::vector<Entity>& entities)
+	{
+		PollReadbacks();
+
+		if (!pickRequested || shader.GetHandle() == 0)
+		{
+			return;
+		}
+
+		// Keep the request for a later frame while every readback slot is still in flight
+		Readback& readback = readbacks[nextSlot];
+		if (readback.fence != nullptr)
+		{
+			return;
+		}
+
+		// Same size and format as the scene target, so the pool hands back the one dynamic resolution released
+		RenderTarget* target = RenderTargetPool::Acquire({ static_cast<int>(Graphics::projWidth), static_cast<int>(Graphics::projHeight), GL_RGB8, true });
+		if (target == nullptr)
+		{
+			return;
+		}
+
+		GLint previousFramebuffer = 0;
+		glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+		GraphicsStats::Count(GLCallCategory::FramebufferBind);
+		RenderIDs(entities);
+
+		// Queue the read of the pixel under the cursor, the result is collected once the fence signals
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+		glReadPixels(requestX, requestY, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		readback.isClick = requestIsClick;
+		nextSlot = (nextSlot + 1) % ReadbackSlots;
+
+		glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+		GraphicsStats::Count(GLCallCategory::FramebufferBind);
+
+		// The read is already queued into the PBO, later passes may draw into the target
+		RenderTargetPool::Release(target);
+
+		pickRequested = false;
+		requestIsClick = false;
+	}
+
+	bool GraphicsPicking::ConsumeClick(Entity& entity)
+	{
+		if (!hasClickResult)
+		{
+			return false;
+		}
+		entity = clickedEntity;
+		hasClickResult = false;
+		return true;
+	}
+
+	void GraphicsPicking::RenderIDs(const std::vector<Entity>& entities)
+	{
+		// Clear to ID 0 (nothing) without touching the scene's clear color
+		GLfloat clearColor[4]{};
+		glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+		glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+
+		// IDs must not be blended
+		glDisable(GL_BLEND);
+		GraphicsStats::Count(GLCallCategory::StateChange);
+
+		Graphics::Model& sprite = Graphics::getMesh("sprite");
+		shader.Use();
+		glBindVertexArray(sprite.vaoid);
+		glUniformMatrix4fv(viewMatrixLocation, 1, GL_FALSE, glm::value_ptr(sprite.viewMatrix));
+		glUniformMatrix4fv(projectionMatrixLocation, 1, GL_FALSE, glm::value_ptr(sprite.projectionMatrix));
+		GraphicsStats::Count(GLCallCategory::UniformUpload, 2);
+
+		auto drawQuad = [](Entity entity, GLuint texture, float alpha, const glm::mat4& modelMatrix, const glm::vec4& uvRect)
+		{
+			bool useTexture = (texture != 0);
+			if (useTexture)
+			{
+				glBindTexture(GL_TEXTURE_2D, texture);
+				GraphicsStats::Count(GLCallCategory::TextureBind);
+			}
+
+			// Offset by one so a cleared pixel reads back as "no entity"
+			glUniform1i(entityIDLocation, static_cast<GLint>(entity) + 1);
+			glUniform1i(useTextureLocation, useTexture);
+			glUniform1f(alphaLocation, alpha);
+			glUniform4f(uvRectLocation, uvRect.x, uvRect.y, uvRect.z, uvRect.w);
+			glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelMatrix));
+			GraphicsStats::Count(GLCallCategory::UniformUpload, 5);
+
+			glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+			GraphicsStats::Count(GLCallCategory::DrawCall);
+		};
+
+		auto findTexture = [](const std::string& name) -> GLuint
+		{
+			auto it = Graphics::textures.find(name);
+			return it != Graphics::textures.end() ? it->second : 0;
+		};
+
+		const glm::vec4 fullRect(0.0f, 0.0f, 1.0f, 1.0f);
+
+		// Same visibility rules and draw order as the scene pass in Graphics::Update
+		for (Entity entity : entities)
+		{
+			// The list is only rebuilt when the scene is re-rendered, entities may have changed since
+			if (!ecsInterface.IsEntityValid(entity) || !ecsInterface.HasComponent<TransformComponent>(entity)
+				|| !ecsInterface.HasComponent<RenderComponent>(entity) || !ecsInterface.HasComponent<LayerComponent>(entity))
+			{
+				continue;
+			}
+
+			const TransformComponent& transformComponent = ecsInterface.GetComponent<TransformComponent>(entity);
+			const RenderComponent& renderComponent = ecsInterface.GetComponent<RenderComponent>(entity);
+			const LayerComponent& layerComponent = ecsInterface.GetComponent<LayerComponent>(entity);
+
+			if (!engineState.layerVisibility[layerComponent.layerID] || !renderComponent.isActive)
+			{
+				continue;
+			}
+
+			if (ecsInterface.HasComponent<AnimationComponent>(entity))
+			{
+				// Current sprite-sheet frame, trimmed like Graphics draws it, animated sprites are drawn without rotation
+				const AnimationComponent& animationComponent = ecsInterface.GetComponent<AnimationComponent>(entity);
+				int drawnFrame = AnimationPlayback::DrawnFrame(entity, animationComponent.rows * animationComponent.cols);
+				SpriteFrame frame = SpriteFrames::FrameOf(renderComponent.textureID, drawnFrame, animationComponent.cols, animationComponent.rows);
+				if (!frame.IsEmpty())
+				{
+					glm::vec2 scale(transformComponent.scale.x, transformComponent.scale.y);
+					glm::vec2 position(transformComponent.position.x, transformComponent.position.y);
+					glm::vec2 quadCenter(frame.quadRect.x + frame.quadRect.z * 0.5f, frame.quadRect.y + frame.quadRect.w * 0.5f);
+					drawQuad(entity, findTexture(renderComponent.textureID), renderComponent.alpha,
+						Graphics::calculate2DTransform(position + scale * quadCenter, 0.0f, scale * glm::vec2(frame.quadRect.z, frame.quadRect.w)), frame.uvRect);
+				}
+			}
+			else
+			{
+				drawQuad(entity, findTexture(renderComponent.textureID), renderComponent.alpha,
+					Graphics::calculate2DTransform(transformComponent.position, transformComponent.rotation, transformComponent.scale), fullRect);
+			}
+
+			if (ecsInterface.HasComponent<UIBarComponent>(entity))
+			{
+				const UIBarComponent& barComponent = ecsInterface.GetComponent<UIBarComponent>(entity);
+				glm::vec2 barPos = transformComponent.position + barComponent.offset;
+				drawQuad(entity, findTexture(barComponent.backingTextureID), barComponent.bgAlpha,
+					Graphics::calculate2DTransform(barPos, 0.0f, barComponent.scale), fullRect);
+			}
+		}
+
+		glBindVertexArray(0);
+		shader.UnUse();
+		glEnable(GL_BLEND);
+		GraphicsStats::Count(GLCallCategory::StateChange);
+	}
+
+	void GraphicsPicking::PollReadbacks()
+	{
+		// Oldest first, so the newest finished result is the one that sticks
+		for (std::size_t i = 0; i < ReadbackSlots; ++i)
+		{
+			Readback& readback = readbacks[(nextSlot + i) % ReadbackSlots];
+			if (readback.fence == nullptr)
+			{
+				continue;
+			}
+
+			// Zero timeout: only collect readbacks the GPU has already finished
+			GLenum status = glClientWaitSync(readback.fence, 0, 0);
+			if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+			{
+				continue;
+			}
+			glDeleteSync(readback.fence);
+			readback.fence = nullptr;
+
+			unsigned char pixel[4]{};
+			glGetNamedBufferSubData(readback.pbo, 0, sizeof(pixel), pixel);
+
+			GLuint id = static_cast<GLuint>(pixel[0]) | (static_cast<GLuint>(pixel[1]) << 8) | (static_cast<GLuint>(pixel[2]) << 16);
+			Entity entity = (id == 0) ? NoEntity : static_cast<Entity>(id - 1);
+
+			// An entity can be destroyed between the request and the result
+			if (entity != NoEntity && !ecsInterface.IsEntityValid(entity))
+			{
+				entity = NoEntity;
+			}
+
+			hoveredEntity = entity;
+			if (readback.isClick)
+			{
+				clickedEntity = entity;
+				hasClickResult = true;
+			}
+		}
+	}
+}
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GraphicsPicking.h
+///
+/// @brief Editor entity picking through an ID buffer. Renders entity IDs into
+///        a pooled render target only when a pick is requested (mouse moved or
+///        clicked over the viewport) and reads the pixel under the cursor back
+///        through a pixel buffer object guarded by a fence, so the CPU never
+///        waits on the GPU.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _GRAPHICS_PICKING_H_
+#define _GRAPHICS_PICKING_H_
+
+#include <glew.h>
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+#include "GraphicsShader.h"
+#include "ComponentList.h"
+
+namespace Framework {
+
+	class GraphicsPicking
+	{
+	public:
+		// Entity value meaning "nothing under the cursor", same as the editor's unselected entity
+		static constexpr Entity NoEntity = std::numeric_limits<Entity>::max();
+
+		/**
+		 * @brief Builds the picking shader from UE.vert and UE_Tint.frag and creates the readback buffers.
+		 */
+		static void Initialize(std::string const& vertexShader, std::string const& fragmentShader);
+
+		/**
+		 * @brief Asks for the entity at a pixel of the game framebuffer (origin bottom-left).
+		 *
+		 * @param isClick true if the pick should also be reported through ConsumeClick.
+		 */
+		static void RequestPick(int x, int y, bool isClick);
+
+		/**
+		 * @brief Renders the ID pass for a pending request and collects finished readbacks.
+		 *        Called once per frame by Graphics::Update after the scene is drawn.
+		 *
+		 * @param entities entities in draw order, the last one drawn wins a pixel.
+		 */
+		static void Update(const std::vector<Entity>& entities);
+
+		// Entity under the cursor from the most recent finished readback
+		static Entity GetHoveredEntity() { return hoveredEntity; }
+
+		/**
+		 * @brief Returns the result of a finished click pick once.
+		 *
+		 * @return true if a click pick finished since the last call; entity is NoEntity when it hit nothing.
+		 */
+		static bool ConsumeClick(Entity& entity);
+
+	private:
+		// Readbacks in flight; requests are dropped while all slots are busy
+		static constexpr std::size_t ReadbackSlots = 3;
+
+		struct Readback
+		{
+			GLuint pbo = 0;
+			GLsync fence = nullptr;
+			bool isClick = false;
+		};
+
+		static void RenderIDs(const std::vector<Entity>& entities);
+		static void PollReadbacks();
+
+		static UE_Shader shader;
+		static std::array<Readback, ReadbackSlots> readbacks;
+		static std::size_t nextSlot;
+
+		static bool pickRequested;
+		static bool requestIsClick;
+		static int requestX, requestY;
+
+		static Entity hoveredEntity;
+		static Entity clickedEntity;
+		static bool hasClickResult;
+
+		// Uniform locations in the picking shader
+		static GLint modelMatrixLocation, viewMatrixLocation, projectionMatrixLocation;
+		static GLint entityIDLocation, useTextureLocation, alphaLocation, uvRectLocation;
+	};
+}
+#endif // !_GRAPHICS_PICKING_H_
@@ -12,6 +12,9 @@
 
 #include "pch.h"
 #include <GraphicsShader.h>
+#include "GraphicsStats.h"
+#include "GLCapture.h"
+#include "AssetArchive.h"
 #include <glew.h>
 #include <iostream>
 #include <fstream>
@@ -33,7 +36,7 @@ UE_Shader::GetUniformLocation(GLchar const* name, bool exit_on_error)
 GLboolean
 UE_Shader::FileExists(std::string const& file_name)
 {
-  std::ifstream infile(file_name); return infile.good();
+  return Framework::AssetArchive::Exists(file_name);
 }
 
 std::string UE_Shader::GetShaderSource(GLenum shaderType) const
@@ -116,15 +119,13 @@ UE_Shader::CompileShaderFromFile(GLenum shader_type, const std::string& file_nam
     }
   }
 
-  std::ifstream shader_file(file_name, std::ifstream::in);
-  if (!shader_file) {
+  // Packed builds read the source from the asset archive, development builds from the loose file
+  Framework::AssetData shader_file;
+  if (!Framework::AssetArchive::Open(file_name, shader_file)) {
     log_string = "Error opening file " + file_name;
     return GL_FALSE;
   }
-  std::stringstream buffer;
-  buffer << shader_file.rdbuf();
-  shader_file.close();
-  return CompileShaderFromString(shader_type, buffer.str());
+  return CompileShaderFromString(shader_type, shader_file.AsString());
 }
 
 GLboolean
@@ -211,6 +212,8 @@ GLboolean UE_Shader::Link() {
 void UE_Shader::Use() {
   if (pgm_handle > 0 && is_linked == GL_TRUE) {
     glUseProgram(pgm_handle);
+    Framework::GraphicsStats::Count(Framework::GLCallCategory::ProgramSwitch);
+    Framework::GLCapture::RecordUseProgram(pgm_handle);
   }
 }
 
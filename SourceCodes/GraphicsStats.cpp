@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GraphicsStats.cpp
+///
+/// @brief Counts GL calls per frame by category and tracks the live GL buffers
+///        and textures (with their byte sizes) owned by the renderer.
+///
+///	@Authors: Victor lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "GraphicsStats.h"
+#include <cassert>
+#include <iostream>
+#include "imgui.h"
+
+namespace Framework {
+
+	std::array<unsigned int, static_cast<std::size_t>(GLCallCategory::Count)> GraphicsStats::currentFrame{};
+	std::array<unsigned int, static_cast<std::size_t>(GLCallCategory::Count)> GraphicsStats::lastFrame{};
+	std::unordered_map<GLuint, std::size_t> GraphicsStats::liveBuffers{};
+	std::unordered_map<GLuint, std::size_t> GraphicsStats::liveTextures{};
+	std::size_t GraphicsStats::liveBufferBytes{};
+	std::size_t GraphicsStats::liveTextureBytes{};
+	std::size_t GraphicsStats::previousLiveObjects{};
+	int GraphicsStats::growthFrames{};
+	bool GraphicsStats::growthWarned{};
+
+	// Display names, same order as GLCallCategory
+	static const char* categoryNames[] =
+	{
+		"Draw calls",
+		"Buffer creates",
+		"Buffer deletes",
+		"Texture creates",
+		"Texture deletes",
+		"Texture binds",
+		"Program switches",
+		"Uniform uploads",
+		"Framebuffer binds",
+		"State changes"
+	};
+	static_assert(sizeof(categoryNames) / sizeof(categoryNames[0]) == static_cast<std::size_t>(GLCallCategory::Count),
+		"categoryNames must match GLCallCategory");
+
+	// Bytes per texel for the internal formats the engine creates
+	static std::size_t BytesPerTexel(GLint internalFormat)
+	{
+		switch (internalFormat)
+		{
+		case GL_R8:
+		case GL_RED:
+			return 1;
+		case GL_RG8:
+			return 2;
+		case GL_RGB:
+		case GL_RGB8:
+			return 3;
+		case GL_DEPTH24_STENCIL8:
+		case GL_RGBA:
+		case GL_RGBA8:
+		default:
+			return 4;
+		}
+	}
+
+	void GraphicsStats::BeginFrame()
+	{
+		currentFrame.fill(0);
+	}
+
+	void GraphicsStats::EndFrame()
+	{
+		lastFrame = currentFrame;
+
+		// Live objects growing every single frame means something is created per frame and never freed
+		std::size_t liveObjects = liveBuffers.size() + liveTextures.size();
+		if (liveObjects > previousLiveObjects)
+		{
+			++growthFrames;
+		}
+		else
+		{
+			// The next streak is a new one and warns again
+			growthFrames = 0;
+			growthWarned = false;
+		}
+		previousLiveObjects = liveObjects;
+
+		if (growthFrames >= GrowthFrameLimit && !growthWarned)
+		{
+			growthWarned = true;
+			std::cerr << "Warning: live GL buffers/textures grew every frame for " << growthFrames
+				<< " frames (" << liveObjects << " live) - possible resource leak in the renderer" << std::endl;
+		}
+		// No scene load lasts this long, the renderer leaks something every frame
+		assert(growthFrames < GrowthAssertLimit && "Live GL buffers/textures keep growing every frame - resource leak in the renderer");
+	}
+
+	void GraphicsStats::Count(GLCallCategory category, unsigned int amount)
+	{
+		currentFrame[static_cast<std::size_t>(category)] += amount;
+	}
+
+	void GraphicsStats::CountText(std::size_t characters)
+	{
+		unsigned int glyphs = static_cast<unsigned int>(characters);
+		Count(GLCallCategory::UniformUpload, 2);
+		Count(GLCallCategory::TextureBind, glyphs);
+		Count(GLCallCategory::DrawCall, glyphs);
+	}
+
+	void GraphicsStats::TrackBuffer(GLuint handle, std::size_t bytes)
+	{
+		if (handle == 0)
+		{
+			return;
+		}
+		auto it = liveBuffers.find(handle);
+		if (it != liveBuffers.end())
+		{
+			liveBufferBytes -= it->second;
+		}
+		liveBuffers[handle] = bytes;
+		liveBufferBytes += bytes;
+		Count(GLCallCategory::BufferCreate);
+	}
+
+	void GraphicsStats::UntrackBuffer(GLuint handle)
+	{
+		auto it = liveBuffers.find(handle);
+		if (it == liveBuffers.end())
+		{
+			return;
+		}
+		liveBufferBytes -= it->second;
+		liveBuffers.erase(it);
+		Count(GLCallCategory::BufferDelete);
+	}
+
+	void GraphicsStats::TrackTexture(GLuint handle, std::size_t bytes)
+	{
+		if (handle == 0)
+		{
+			return;
+		}
+		auto it = liveTextures.find(handle);
+		if (it != liveTextures.end())
+		{
+			liveTextureBytes -= it->second;
+		}
+		liveTextures[handle] = bytes;
+		liveTextureBytes += bytes;
+		Count(GLCallCategory::TextureCreate);
+	}
+
+	void GraphicsStats::TrackTexture(GLuint handle)
+	{
+		if (handle == 0)
+		{
+			return;
+		}
+		GLint width = 0, height = 0, internalFormat = 0;
+		glGetTextureLevelParameteriv(handle, 0, GL_TEXTURE_WIDTH, &width);
+		glGetTextureLevelParameteriv(handle, 0, GL_TEXTURE_HEIGHT, &height);
+		glGetTextureLevelParameteriv(handle, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+		TrackTexture(handle, static_cast<std::size_t>(width) * height * BytesPerTexel(internalFormat));
+	}
+
+	void GraphicsStats::UntrackTexture(GLuint handle)
+	{
+		auto it = liveTextures.find(handle);
+		if (it == liveTextures.end())
+		{
+			return;
+		}
+		liveTextureBytes -= it->second;
+		liveTextures.erase(it);
+		Count(GLCallCategory::TextureDelete);
+	}
+
+	unsigned int GraphicsStats::GetLastFrameCount(GLCallCategory category)
+	{
+		return lastFrame[static_cast<std::size_t>(category)];
+	}
+
+	void GraphicsStats::ShowImGui()
+	{
+		if (ImGui::CollapsingHeader("GL Stats (last frame)", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			for (std::size_t i = 0; i < lastFrame.size(); ++i)
+			{
+				ImGui::Text("%s: %u", categoryNames[i], lastFrame[i]);
+			}
+
+			ImGui::Separator();
+			ImGui::Text("Live buffers: %zu (%.2f KB)", liveBuffers.size(), liveBufferBytes / 1024.0);
+			ImGui::Text("Live textures: %zu (%.2f MB)", liveTextures.size(), liveTextureBytes / (1024.0 * 1024.0));
+
+			if (growthFrames > 0)
+			{
+				ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.0f, 1.0f), "Live objects growing for %d frames", growthFrames);
+			}
+		}
+	}
+}
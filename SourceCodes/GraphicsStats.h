@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GraphicsStats.h
+///
+/// @brief Per-frame accounting of the OpenGL calls made by the renderer and
+///        of the GL buffers / textures that are currently alive.
+///
+///	@Authors: Victor lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _GRAPHICS_STATS_H_
+#define _GRAPHICS_STATS_H_
+
+#include <glew.h>
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+
+namespace Framework {
+
+	// Categories of GL calls that are counted every frame
+	enum class GLCallCategory
+	{
+		DrawCall = 0,
+		BufferCreate,
+		BufferDelete,
+		TextureCreate,
+		TextureDelete,
+		TextureBind,
+		ProgramSwitch,
+		UniformUpload,
+		FramebufferBind,
+		StateChange,        // glEnable / glDisable / glBlendFunc
+		Count
+	};
+
+	class GraphicsStats
+	{
+	public:
+		/**
+		 * @brief Resets the per-frame call counters. Called once at the start of Graphics::Update.
+		 */
+		static void BeginFrame();
+
+		/**
+		 * @brief Publishes the counters of the frame that just finished and checks live object growth.
+		 *
+		 * Warns when the number of live buffers or textures has grown every frame for
+		 * GrowthFrameLimit frames in a row (resources created per frame and never freed), once per
+		 * streak. Loading a large scene can legitimately do that, so it is only reported and the panel
+		 * shows the streak; debug builds assert once the streak reaches GrowthAssertLimit.
+		 */
+		static void EndFrame();
+
+		/**
+		 * @brief Counts a GL call in the given category for the current frame.
+		 *
+		 * @param category : type of GL call
+		 * @param amount : number of calls to add
+		 */
+		static void Count(GLCallCategory category, unsigned int amount = 1);
+
+		/**
+		 * @brief Counts the GL calls of one FontSystem::RenderText call, which is built outside the renderer.
+		 *        It uploads the colour and projection uniforms, then binds each character's glyph texture
+		 *        and draws its quad; the program switch is counted by UE_Shader::Use.
+		 *
+		 * @param characters : length of the rendered string
+		 */
+		static void CountText(std::size_t characters);
+
+		/**
+		 * @brief Registers a live GL buffer with its storage size in bytes.
+		 */
+		static void TrackBuffer(GLuint handle, std::size_t bytes);
+
+		/**
+		 * @brief Removes a GL buffer from the live set. Unknown handles are ignored.
+		 */
+		static void UntrackBuffer(GLuint handle);
+
+		/**
+		 * @brief Registers a live GL texture with its storage size in bytes.
+		 */
+		static void TrackTexture(GLuint handle, std::size_t bytes);
+
+		/**
+		 * @brief Registers a live GL texture, querying its level 0 size and format from GL.
+		 */
+		static void TrackTexture(GLuint handle);
+
+		/**
+		 * @brief Removes a GL texture from the live set. Unknown handles are ignored.
+		 */
+		static void UntrackTexture(GLuint handle);
+
+		// Counters of the last completed frame
+		static unsigned int GetLastFrameCount(GLCallCategory category);
+
+		static std::size_t GetLiveBufferCount()  { return liveBuffers.size(); }
+		static std::size_t GetLiveTextureCount() { return liveTextures.size(); }
+		static std::size_t GetLiveBufferBytes()  { return liveBufferBytes; }
+		static std::size_t GetLiveTextureBytes() { return liveTextureBytes; }
+
+		/**
+		 * @brief Draws the counters inside the currently open ImGui window (DebugSystem panel).
+		 */
+		static void ShowImGui();
+
+		// Number of consecutive frames of live object growth tolerated before warning
+		static constexpr int GrowthFrameLimit = 120;
+
+		// Number of consecutive frames of live object growth that asserts in debug builds
+		static constexpr int GrowthAssertLimit = 600;
+
+	private:
+		static std::array<unsigned int, static_cast<std::size_t>(GLCallCategory::Count)> currentFrame;
+		static std::array<unsigned int, static_cast<std::size_t>(GLCallCategory::Count)> lastFrame;
+
+		static std::unordered_map<GLuint, std::size_t> liveBuffers;
+		static std::unordered_map<GLuint, std::size_t> liveTextures;
+		static std::size_t liveBufferBytes;
+		static std::size_t liveTextureBytes;
+
+		static std::size_t previousLiveObjects;
+		static int growthFrames;
+		static bool growthWarned;
+	};
+}
+#endif // !_GRAPHICS_STATS_H_
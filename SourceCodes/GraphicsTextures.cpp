@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GraphicsTextures.cpp
+///
+/// @brief Immutable texture storage, mip generation, cooked texture upload
+///        and shared samplers.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "GraphicsTextures.h"
+#include <algorithm>
+#include "AssetManager.h"
+#include "CookedTexture.h"
+#include "GraphicsStats.h"
+#include "GLCapture.h"
+#include "SpriteFrames.h"
+
+namespace Framework {
+
+	std::array<GLuint, static_cast<std::size_t>(SamplerType::Count)> GraphicsTextures::samplers{};
+	GLuint GraphicsTextures::boundSampler{};
+
+	static GLuint CreateSampler(GLint minFilter, GLint magFilter, GLint wrap)
+	{
+		GLuint sampler = 0;
+		glCreateSamplers(1, &sampler);
+		glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, minFilter);
+		glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, magFilter);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, wrap);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, wrap);
+		return sampler;
+	}
+
+	void GraphicsTextures::Initialize()
+	{
+		samplers[static_cast<std::size_t>(SamplerType::LinearMipmapClamp)] = CreateSampler(GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
+		samplers[static_cast<std::size_t>(SamplerType::LinearClamp)] = CreateSampler(GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
+		samplers[static_cast<std::size_t>(SamplerType::NearestClamp)] = CreateSampler(GL_NEAREST, GL_NEAREST, GL_CLAMP_TO_EDGE);
+		samplers[static_cast<std::size_t>(SamplerType::LinearMipmapRepeat)] = CreateSampler(GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, GL_REPEAT);
+	}
+
+	// Storage of a full RGBA8 chain, level 0 plus every level below it
+	static std::size_t MipChainBytes(GLsizei width, GLsizei height, GLsizei levels)
+	{
+		std::size_t bytes = 0;
+		for (GLsizei level = 0; level < levels; ++level)
+		{
+			bytes += static_cast<std::size_t>(std::max(1, width >> level)) * std::max(1, height >> level) * 4;
+		}
+		return bytes;
+	}
+
+	LoadedTexture GraphicsTextures::CreateTexture(GLsizei width, GLsizei height, const void* pixels)
+	{
+		GLsizei levels = MipLevelCount(width, height);
+
+		LoadedTexture loaded;
+		glCreateTextures(GL_TEXTURE_2D, 1, &loaded.texture);
+		glTextureStorage2D(loaded.texture, levels, GL_RGBA8, width, height);
+		glTextureSubImage2D(loaded.texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		glGenerateTextureMipmap(loaded.texture);
+
+		loaded.bytes = MipChainBytes(width, height, levels);
+		GraphicsStats::TrackTexture(loaded.texture, loaded.bytes);
+		return loaded;
+	}
+
+	LoadedTexture GraphicsTextures::Upload(const CookedTexture& cooked)
+	{
+		LoadedTexture loaded;
+		const CookedTextureHeader& header = cooked.Header();
+		glCreateTextures(GL_TEXTURE_2D, 1, &loaded.texture);
+		glTextureStorage2D(loaded.texture, static_cast<GLsizei>(header.mipCount), GL_RGBA8,
+			static_cast<GLsizei>(header.width), static_cast<GLsizei>(header.height));
+		// Cooked rows are tightly packed RGBA8; the caller's unpack alignment is restored afterwards, it is global GL state
+		GLint previousAlignment = 4;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousAlignment);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		for (std::uint32_t level = 0; level < header.mipCount; ++level)
+		{
+			const CookedMipEntry& mip = cooked.Mip(level);
+			glTextureSubImage2D(loaded.texture, static_cast<GLint>(level), 0, 0, static_cast<GLsizei>(mip.width), static_cast<GLsizei>(mip.height),
+				GL_RGBA, GL_UNSIGNED_BYTE, cooked.MipData(level));
+			loaded.bytes += static_cast<std::size_t>(mip.size);
+		}
+		glPixelStorei(GL_UNPACK_ALIGNMENT, previousAlignment);
+		loaded.premultiplied = cooked.IsPremultiplied();
+
+		GraphicsStats::TrackTexture(loaded.texture, loaded.bytes);
+		return loaded;
+	}
+
+	LoadedTexture GraphicsTextures::Load(const std::string& assetName)
+	{
+		LoadedTexture loaded;
+
+		// Prefer the cooked file when the AssetManager has not uploaded the source image yet,
+		// handing it the GL name so the asset browser, rename and delete keep working
+		auto& textureAssets = GlobalAssetManager.UE_GetAllTextureAssets();
+		auto asset = textureAssets.find(assetName);
+		if (asset != textureAssets.end() && asset->second.textureID == 0)
+		{
+			CookedTexture cooked;
+			if (cooked.Open(CookedTexture::CookedPathFor(SpriteFrames::SourcePathOf(assetName, asset->second.path)), asset->second.path))
+			{
+				loaded = Upload(cooked);
+				asset->second.textureID = loaded.texture;
+				return loaded;
+			}
+
+			// The grid image is loaded below, its frames need grid UVs
+			SpriteFrames::Remove(assetName);
+		}
+
+		GLuint texture = GlobalAssetManager.UE_LoadTextureToOpenGL(assetName);
+		if (texture == 0)
+		{
+			return loaded;
+		}
+
+		GLint width = 0, height = 0, immutableLevels = 0;
+		glGetTextureLevelParameteriv(texture, 0, GL_TEXTURE_WIDTH, &width);
+		glGetTextureLevelParameteriv(texture, 0, GL_TEXTURE_HEIGHT, &height);
+		glGetTextureParameteriv(texture, GL_TEXTURE_IMMUTABLE_LEVELS, &immutableLevels);
+
+		// The AssetManager keeps owning the texture (asset browser, rename, delete), so a texture it
+		// uploaded with glTexImage2D gets its chain in place rather than being swapped for a new name
+		GLsizei levels = immutableLevels > 0 ? immutableLevels : MipLevelCount(width, height);
+		if (immutableLevels == 0 && levels > 1)
+		{
+			glTextureParameteri(texture, GL_TEXTURE_MAX_LEVEL, levels - 1);
+			glGenerateTextureMipmap(texture);
+		}
+
+		loaded.texture = texture;
+		loaded.bytes = MipChainBytes(width, height, levels);
+		GraphicsStats::TrackTexture(texture, loaded.bytes);
+		return loaded;
+	}
+
+	void GraphicsTextures::BindSampler(SamplerType type)
+	{
+		GLuint sampler = GetSampler(type);
+		if (sampler != boundSampler)
+		{
+			glBindSampler(0, sampler);
+			boundSampler = sampler;
+		}
+		GLCapture::RecordBindSampler(sampler);
+	}
+
+	void GraphicsTextures::UnbindSampler()
+	{
+		if (boundSampler != 0)
+		{
+			glBindSampler(0, 0);
+			boundSampler = 0;
+		}
+	}
+
+	GLsizei GraphicsTextures::MipLevelCount(GLsizei width, GLsizei height)
+	{
+		GLsizei levels = 1;
+		for (GLsizei size = std::max(width, height); size > 1; size >>= 1)
+		{
+			++levels;
+		}
+		return levels;
+	}
+}
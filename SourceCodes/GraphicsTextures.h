@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file GraphicsTextures.h
+///
+/// @brief Texture creation and sampling state for the renderer. Textures get
+///        a full mip chain once, when they are first loaded, and filtering
+///        lives in a few shared sampler objects that models select instead of
+///        setting texture parameters per draw.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _GRAPHICS_TEXTURES_H_
+#define _GRAPHICS_TEXTURES_H_
+
+#include <glew.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Framework {
+
+	class CookedTexture;
+
+	enum class SamplerType : std::uint8_t
+	{
+		LinearMipmapClamp,  // Trilinear, default for sprites so zoomed-out views sample small mips
+		LinearClamp,        // Bilinear on level 0, for UI drawn at native size
+		NearestClamp,       // Point sampling, for pixel art and lookup textures
+		LinearMipmapRepeat, // Trilinear with wrapping, for tiled backgrounds
+		Count
+	};
+
+	struct LoadedTexture
+	{
+		GLuint texture = 0;
+		std::size_t bytes = 0;          // Storage including the mip chain
+		bool premultiplied = false;     // Colour is premultiplied by alpha, draw with GL_ONE blending
+	};
+
+	class GraphicsTextures
+	{
+	public:
+		/**
+		 * @brief Creates the shared sampler objects. Called once by Graphics::Initialize.
+		 */
+		static void Initialize();
+
+		/**
+		 * @brief Creates an immutable RGBA8 texture with a full mip chain generated from the pixels.
+		 *        This is how image loaders should create textures; the result is tracked in GraphicsStats.
+		 *
+		 * @param pixels : width * height RGBA8 texels, first row at the bottom
+		 */
+		static LoadedTexture CreateTexture(GLsizei width, GLsizei height, const void* pixels);
+
+		/**
+		 * @brief Uploads every level of an opened cooked texture into immutable storage
+		 *        and tracks it in GraphicsStats. No decode or mip generation happens here.
+		 */
+		static LoadedTexture Upload(const CookedTexture& cooked);
+
+		/**
+		 * @brief Loads a texture asset for rendering and tracks it in GraphicsStats.
+		 *        A cooked file under Assets/Cooked (see AssetCooker) is memory mapped and uploaded with
+		 *        no decode; otherwise the AssetManager loads the source image and textures it created
+		 *        without mips get their chain generated here, once.
+		 *
+		 * Use through Graphics::GetTexture, which keeps the result resident in TextureResidency.
+		 *
+		 * @return the texture, 0 if the asset could not be loaded.
+		 */
+		static LoadedTexture Load(const std::string& assetName);
+
+		/**
+		 * @brief Binds a shared sampler to texture unit 0, the only unit the sprite shaders use.
+		 *        Redundant binds are skipped.
+		 */
+		static void BindSampler(SamplerType type);
+
+		/**
+		 * @brief Unbinds the sampler from unit 0 so code that sets its own texture
+		 *        parameters (font atlas, ImGui) samples as before.
+		 */
+		static void UnbindSampler();
+
+		static GLuint GetSampler(SamplerType type) { return samplers[static_cast<std::size_t>(type)]; }
+
+		// Number of levels in a full mip chain down to 1x1
+		static GLsizei MipLevelCount(GLsizei width, GLsizei height);
+
+	private:
+		static std::array<GLuint, static_cast<std::size_t>(SamplerType::Count)> samplers;
+
+		// Sampler bound to unit 0 by BindSampler, 0 when unknown or unbound
+		static GLuint boundSampler;
+	};
+}
+#endif // !_GRAPHICS_TEXTURES_H_
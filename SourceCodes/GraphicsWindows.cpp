@@ -11,10 +11,14 @@
 
 #include "pch.h"
 
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include "GraphicsWindows.h"
 #include "Core.h"
 #include "EngineState.h"
+#include "HeadlessBenchmark.h"
+#include "SceneEvents.h"
 
 namespace Framework {
 
@@ -39,6 +43,20 @@ namespace Framework {
     GraphicsWindows::GraphicsWindows(const Window::WindowConfig& config, CoreEngine* CorePointer)
         : screenWidth(config.x), screenHeight(config.y), windowTitle(config.programName),
         window(nullptr), isInitialized(false), CorePointer(CorePointer) {
+        // Benchmark executables turn headless mode on themselves, the game reads it from its arguments
+        if (!HeadlessBenchmark::IsEnabled())
+        {
+            HeadlessBenchmark::ParseProcessCommandLine();
+        }
+
+        if (HeadlessBenchmark::IsEnabled())
+        {
+#if GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4)
+            // No display server needed, the context is created by EGL surfaceless or OSMesa
+            glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+        }
+
         if (!glfwInit()) {
             std::cerr << "Failed to initialize GLFW" << std::endl;
             return;
@@ -46,6 +64,18 @@ namespace Framework {
 
         glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
 
+        if (HeadlessBenchmark::IsEnabled())
+        {
+            // Invisible window that only owns the GL context, rendering goes to gameFramebuffer
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+            glfwWindowHint(GLFW_CONTEXT_CREATION_API,
+                HeadlessBenchmark::settings.context == HeadlessContext::OSMesa ? GLFW_OSMESA_CONTEXT_API : GLFW_EGL_CONTEXT_API);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+            fullscreen = false;
+        }
+
         window = glfwCreateWindow(screenWidth, screenHeight, windowTitle.c_str(), nullptr, nullptr);
         if (!window) {
             std::cerr << "Failed to create GLFW window" << std::endl;
@@ -83,6 +113,14 @@ namespace Framework {
     void GraphicsWindows::Initialize() {
 
         InputHandler = InputHandler::GetInstance();
+
+        // Headless runs go straight into play mode on the requested scene
+        if (HeadlessBenchmark::IsEnabled() && !HeadlessBenchmark::settings.scenePath.empty())
+        {
+            GlobalAssetManager.UE_LoadEntities(HeadlessBenchmark::settings.scenePath);
+            SceneEvents::OnSceneLoaded(HeadlessBenchmark::settings.scenePath);
+            engineState.SetPlay(true);
+        }
     }
 
     /**
@@ -96,6 +134,19 @@ namespace Framework {
 
         (void)deltaTime;
 
+        if (HeadlessBenchmark::IsEnabled())
+        {
+            // Nothing is presented, wait for the GPU so the frame time includes rendering
+            glFinish();
+            HeadlessBenchmark::RecordFrame();
+            if (HeadlessBenchmark::IsFinished())
+            {
+                HeadlessBenchmark::WriteResults();
+                CorePointer->EndGameLoop();
+            }
+            return;
+        }
+
         //testing if windows are being seen or not
         if (glfwGetWindowAttrib(window, GLFW_ICONIFIED))
         {
@@ -185,6 +236,7 @@ namespace Framework {
 
         glfwSwapBuffers(window);
 
+#ifdef _WIN32
         if (isQuit == true)
         {
             // Use MB_TOPMOST to ensure the message box appears in front of the fullscreen window
@@ -217,8 +269,10 @@ namespace Framework {
         if (result2 == IDYES)
         {
             Framework::GlobalSceneManager.TransitionToScene("Assets/Scene/MenuScene.json");
+            SceneEvents::OnSceneLoaded("Assets/Scene/MenuScene.json");
             result2 = IDNO;
         }
+#endif
     }
 
 
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file HeadlessBenchmark.cpp
+///
+/// @brief Parses headless command line options and records per-frame timings
+///        so renderer throughput can be measured on machines without a display.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "HeadlessBenchmark.h"
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include "GraphicsStats.h"
+#include "DynamicResolution.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/prettywriter.h"
+
+namespace Framework {
+
+    HeadlessSettings HeadlessBenchmark::settings{};
+    std::vector<double> HeadlessBenchmark::frameTimes{};
+    double HeadlessBenchmark::lastFrameTime{};
+    int HeadlessBenchmark::framesRendered{};
+
+    bool HeadlessBenchmark::ParseCommandLine(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            bool hasValue = (i + 1 < argc);
+
+            if (arg == "--headless" || arg == "--headless=egl")
+            {
+                settings.enabled = true;
+                settings.context = HeadlessContext::EGL;
+            }
+            else if (arg == "--headless=osmesa")
+            {
+                settings.enabled = true;
+                settings.context = HeadlessContext::OSMesa;
+            }
+            else if (arg == "--frames" && hasValue)
+            {
+                settings.frames = std::max(1, std::atoi(argv[++i]));
+            }
+            else if (arg == "--warmup" && hasValue)
+            {
+                settings.warmupFrames = std::max(0, std::atoi(argv[++i]));
+            }
+            else if (arg == "--scene" && hasValue)
+            {
+                settings.scenePath = argv[++i];
+            }
+            else if (arg == "--out" && hasValue)
+            {
+                settings.outputPath = argv[++i];
+            }
+            else if (arg == "--resolution-scale" && hasValue)
+            {
+                settings.resolutionScale = static_cast<float>(std::atof(argv[++i]));
+            }
+            else if (arg == "--dynamic-resolution")
+            {
+                settings.dynamicResolution = true;
+            }
+            else
+            {
+                std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+            }
+        }
+
+        if (settings.enabled)
+        {
+            frameTimes.reserve(settings.frames);
+            std::cout << "Headless mode: " << settings.frames << " frames, scene '" << settings.scenePath << "'" << std::endl;
+        }
+        return settings.enabled;
+    }
+
+    bool HeadlessBenchmark::ParseProcessCommandLine()
+    {
+#ifdef _WIN32
+        // Filled in by the CRT before main/WinMain runs, null in wide-character programs
+        return __argv ? ParseCommandLine(__argc, __argv) : false;
+#else
+        // Arguments are stored null-separated
+        std::ifstream file("/proc/self/cmdline", std::ios::binary);
+        std::vector<std::string> arguments;
+        std::string argument;
+        while (std::getline(file, argument, '\0'))
+        {
+            arguments.push_back(argument);
+        }
+
+        std::vector<char*> argv;
+        for (std::string& value : arguments)
+        {
+            argv.push_back(value.data());
+        }
+        return ParseCommandLine(static_cast<int>(argv.size()), argv.data());
+#endif
+    }
+
+    void HeadlessBenchmark::RecordFrame()
+    {
+        double now = glfwGetTime();
+
+        // First frame only sets the reference time
+        if (framesRendered > 0 && framesRendered > settings.warmupFrames)
+        {
+            frameTimes.push_back((now - lastFrameTime) * 1000.0);
+        }
+
+        lastFrameTime = now;
+        ++framesRendered;
+    }
+
+    bool HeadlessBenchmark::IsFinished()
+    {
+        return framesRendered >= settings.frames + settings.warmupFrames + 1;
+    }
+
+    bool HeadlessBenchmark::WriteResults()
+    {
+        std::ofstream file(settings.outputPath);
+        if (!file)
+        {
+            std::cerr << "Failed to open headless results file: " << settings.outputPath << std::endl;
+            return false;
+        }
+
+        FrameTimeSummary summary = Summarize(frameTimes);
+
+        // Scene paths (Windows separators) and driver strings are escaped by the writer
+        const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        rapidjson::OStreamWrapper stream(file);
+        rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(stream);
+        writer.SetIndent(' ', 2);
+        writer.StartObject();
+        writer.Key("scene");
+        writer.String(settings.scenePath.c_str());
+        writer.Key("context");
+        writer.String(settings.context == HeadlessContext::EGL ? "egl" : "osmesa");
+        writer.Key("renderer");
+        writer.String(renderer ? renderer : "");
+        writer.Key("frames");
+        writer.Uint64(static_cast<std::uint64_t>(summary.frames));
+        writer.Key("mean_ms");
+        writer.Double(summary.mean);
+        writer.Key("min_ms");
+        writer.Double(summary.min);
+        writer.Key("p50_ms");
+        writer.Double(summary.p50);
+        writer.Key("p95_ms");
+        writer.Double(summary.p95);
+        writer.Key("p99_ms");
+        writer.Double(summary.p99);
+        writer.Key("max_ms");
+        writer.Double(summary.max);
+        writer.Key("resolution_scale");
+        writer.Double(DynamicResolution::GetScale());
+        writer.Key("draw_calls_last_frame");
+        writer.Uint(GraphicsStats::GetLastFrameCount(GLCallCategory::DrawCall));
+        writer.EndObject();
+        file << "\n";
+
+        std::cout << "Headless results written to " << settings.outputPath << " (mean " << summary.mean << " ms)" << std::endl;
+        return true;
+    }
+
+    FrameTimeSummary HeadlessBenchmark::Summarize(std::vector<double> frameTimesMs)
+    {
+        FrameTimeSummary summary;
+        if (frameTimesMs.empty())
+        {
+            return summary;
+        }
+
+        std::sort(frameTimesMs.begin(), frameTimesMs.end());
+
+        auto percentile = [&frameTimesMs](double p) -> double
+        {
+            size_t index = static_cast<size_t>(p * (frameTimesMs.size() - 1) + 0.5);
+            return frameTimesMs[index];
+        };
+
+        summary.frames = frameTimesMs.size();
+        summary.mean = std::accumulate(frameTimesMs.begin(), frameTimesMs.end(), 0.0) / frameTimesMs.size();
+        summary.min = frameTimesMs.front();
+        summary.p50 = percentile(0.50);
+        summary.p95 = percentile(0.95);
+        summary.p99 = percentile(0.99);
+        summary.max = frameTimesMs.back();
+        return summary;
+    }
+}
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file HeadlessBenchmark.h
+///
+/// @brief Command line settings and frame timing for running the renderer
+///        without a visible window (EGL surfaceless or OSMesa context).
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _HEADLESS_BENCHMARK_H_
+#define _HEADLESS_BENCHMARK_H_
+
+#include <string>
+#include <vector>
+
+namespace Framework {
+
+    // Context backend used when running without a window
+    enum class HeadlessContext
+    {
+        EGL,     // EGL_MESA_platform_surfaceless
+        OSMesa   // Mesa off-screen software rasteriser
+    };
+
+    struct HeadlessSettings
+    {
+        bool enabled = false;
+        HeadlessContext context = HeadlessContext::EGL;
+        int frames = 600;                                   // Frames to render before quitting
+        int warmupFrames = 30;                              // Frames excluded from the results
+        std::string scenePath{};                            // Scene loaded and played on start
+        std::string outputPath = "HeadlessResults.json";    // Timing results file
+        float resolutionScale = 1.0f;                       // Locked dynamic resolution scale
+        bool dynamicResolution = false;                     // Let the controller move the scale instead
+    };
+
+    // Frame time statistics in milliseconds
+    struct FrameTimeSummary
+    {
+        size_t frames = 0;
+        double mean = 0.0;
+        double min = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    class HeadlessBenchmark
+    {
+    public:
+        /**
+         * @brief Reads headless options from the program arguments. Called before the window is created.
+         *
+         * Options:
+         *   --headless[=egl|osmesa]   run without a window
+         *   --frames N                number of frames to render (default 600)
+         *   --warmup N                frames ignored at the start (default 30)
+         *   --scene PATH              scene json to load and play
+         *   --out PATH                where timing results are written
+         *   --resolution-scale S      lock the dynamic resolution scale (default 1.0)
+         *   --dynamic-resolution      let the dynamic resolution controller run
+         *
+         * @return true if headless mode was requested.
+         */
+        static bool ParseCommandLine(int argc, char** argv);
+
+        /**
+         * @brief ParseCommandLine over the arguments the process was started with. GraphicsWindows calls this
+         *        before creating the window, so the engine's entry point does not have to forward argc/argv.
+         */
+        static bool ParseProcessCommandLine();
+
+        static bool IsEnabled() { return settings.enabled; }
+
+        /**
+         * @brief Records the end of a rendered frame. Call once per frame after GPU work has finished.
+         */
+        static void RecordFrame();
+
+        // True once the requested number of frames have been rendered
+        static bool IsFinished();
+
+        /**
+         * @brief Writes mean/min/max/percentile frame times in milliseconds to settings.outputPath as JSON.
+         *
+         * @return true if the file was written.
+         */
+        static bool WriteResults();
+
+        /**
+         * @brief Computes mean, min, max and nearest-rank percentiles of a list of frame times.
+         */
+        static FrameTimeSummary Summarize(std::vector<double> frameTimesMs);
+
+        static HeadlessSettings settings;
+
+    private:
+        static std::vector<double> frameTimes;  // Milliseconds, warm-up frames excluded
+        static double lastFrameTime;
+        static int framesRendered;
+    };
+}
+#endif // !_HEADLESS_BENCHMARK_H_
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file JobPool.cpp
+///
+/// @brief Per-thread job queues, stealing and the worker loop.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "JobPool.h"
+#include <algorithm>
+
+namespace Framework {
+
+	std::vector<std::unique_ptr<JobPool::Queue>> JobPool::queues{};
+	std::vector<std::thread> JobPool::workers{};
+	std::atomic<bool> JobPool::stopping{ false };
+	std::atomic<int> JobPool::queuedCount{ 0 };
+	std::mutex JobPool::sleepMutex{};
+	std::condition_variable JobPool::wake{};
+
+	static thread_local unsigned threadIndex = 0;
+
+	// Workers left running at exit would terminate the process when their std::thread is destroyed
+	static struct JobPoolShutdown
+	{
+		~JobPoolShutdown() { JobPool::Stop(); }
+	} jobPoolShutdown;
+
+	void JobPool::Start(unsigned workerCount)
+	{
+		Stop();
+
+		if (workerCount == 0)
+		{
+			workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+		}
+
+		stopping = false;
+		queues.clear();
+		for (unsigned thread = 0; thread <= workerCount; ++thread)
+		{
+			queues.push_back(std::make_unique<Queue>());
+		}
+		for (unsigned thread = 1; thread <= workerCount; ++thread)
+		{
+			workers.emplace_back(WorkerLoop, thread);
+		}
+	}
+
+	void JobPool::Stop()
+	{
+		if (queues.empty())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+		workers.clear();
+
+		// Without workers the main thread finishes what is left
+		while (RunOne())
+		{
+		}
+		queues.clear();
+	}
+
+	unsigned JobPool::GetThreadIndex()
+	{
+		return threadIndex;
+	}
+
+	void JobPool::Push(const Job& job)
+	{
+		if (queues.empty())
+		{
+			Start();
+		}
+
+		{
+			Queue& queue = *queues[threadIndex];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back(job);
+			++queuedCount;
+		}
+
+		// Taking the lock orders the push before a worker's check for work, so the wake-up is not lost
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+		}
+		wake.notify_one();
+	}
+
+	bool JobPool::PopOwn(unsigned thread, Job& job)
+	{
+		Queue& queue = *queues[thread];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty())
+		{
+			return false;
+		}
+		job = queue.jobs.back();
+		queue.jobs.pop_back();
+		--queuedCount;
+		return true;
+	}
+
+	bool JobPool::Steal(unsigned thief, Job& job)
+	{
+		// Victims are visited starting after the thief, so threads do not all pile onto the same queue
+		unsigned count = static_cast<unsigned>(queues.size());
+		for (unsigned offset = 1; offset < count; ++offset)
+		{
+			Queue& queue = *queues[(thief + offset) % count];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.jobs.empty())
+			{
+				continue;
+			}
+			job = queue.jobs.front();
+			queue.jobs.pop_front();
+			--queuedCount;
+			return true;
+		}
+		return false;
+	}
+
+	bool JobPool::RunOne()
+	{
+		if (queues.empty())
+		{
+			return false;
+		}
+
+		Job job;
+		if (!PopOwn(threadIndex, job) && !Steal(threadIndex, job))
+		{
+			return false;
+		}
+		job.function(job.context, job.index);
+		return true;
+	}
+
+	void JobPool::WorkerLoop(unsigned thread)
+	{
+		threadIndex = thread;
+		for (;;)
+		{
+			if (RunOne())
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			wake.wait(lock, [] { return stopping || queuedCount > 0; });
+			if (stopping && queuedCount == 0)
+			{
+				return;
+			}
+		}
+	}
+}
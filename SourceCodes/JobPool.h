@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file JobPool.h
+///
+/// @brief Work-stealing thread pool. Every thread (the main thread is thread
+///        0) owns a queue: it pushes and pops jobs at the back of its own
+///        queue, and a thread with nothing left steals from the front of the
+///        others, so work started on one thread spreads over the idle ones.
+///        Idle workers sleep until a job is pushed.
+///
+///        Jobs are a function pointer with its context, nothing is allocated
+///        per job once the queues have grown.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _JOB_POOL_H_
+#define _JOB_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Framework {
+
+	struct Job
+	{
+		void (*function)(void* context, std::uint32_t index) = nullptr;
+		void* context = nullptr;
+		std::uint32_t index = 0;
+	};
+
+	class JobPool
+	{
+	public:
+		/**
+		 * @brief Starts the worker threads, a running pool is restarted with the new count.
+		 *
+		 * @param workerCount : threads besides the main thread, 0 for one per remaining hardware thread
+		 */
+		static void Start(unsigned workerCount = 0);
+
+		// Finishes the queued jobs and joins the workers
+		static void Stop();
+
+		static bool IsRunning() { return !queues.empty(); }
+
+		// Workers plus the main thread
+		static unsigned GetThreadCount() { return static_cast<unsigned>(queues.size()); }
+
+		// 0 on the main thread (and any thread that is not a worker), 1.. on the workers
+		static unsigned GetThreadIndex();
+
+		// Queues a job on the calling thread's queue
+		static void Push(const Job& job);
+
+		// Runs one job, the calling thread's newest or one stolen from another thread; false if there was none
+		static bool RunOne();
+
+	private:
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		static bool PopOwn(unsigned thread, Job& job);
+		static bool Steal(unsigned thief, Job& job);
+		static void WorkerLoop(unsigned thread);
+
+		static std::vector<std::unique_ptr<Queue>> queues;     // Indexed by thread
+		static std::vector<std::thread> workers;
+		static std::atomic<bool> stopping;
+		static std::atomic<int> queuedCount;
+		static std::mutex sleepMutex;
+		static std::condition_variable wake;
+	};
+}
+#endif // !_JOB_POOL_H_
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file Lz4Block.cpp
+///
+/// @brief LZ4 block format. A block is a run of sequences, each a token
+///        (literal length high nibble, match length - 4 low nibble), extra
+///        length bytes, the literals and a 16-bit little endian match offset.
+///        The last sequence holds literals only.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "Lz4Block.h"
+#include <cstring>
+#include <vector>
+
+namespace Framework {
+
+	static constexpr std::size_t MinMatch = 4;
+	static constexpr std::size_t LastLiterals = 5;   // The format ends every block with at least this many literals
+	static constexpr std::size_t MatchSearchLimit = 12; // No match may start in the last 12 bytes
+	static constexpr std::size_t MaxOffset = 65535;
+	static constexpr unsigned HashBits = 12;
+
+	static std::uint32_t Read32(const std::uint8_t* p)
+	{
+		std::uint32_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	static std::uint32_t Hash(std::uint32_t sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - HashBits);
+	}
+
+	static std::uint8_t* WriteLength(std::uint8_t* out, std::size_t length)
+	{
+		for (; length >= 255; length -= 255)
+		{
+			*out++ = 255;
+		}
+		*out++ = static_cast<std::uint8_t>(length);
+		return out;
+	}
+
+	static std::uint8_t* WriteSequence(std::uint8_t* out, const std::uint8_t* literals, std::size_t literalLength,
+		std::size_t offset, std::size_t matchLength)
+	{
+		std::uint8_t* token = out++;
+		std::size_t matchCode = matchLength >= MinMatch ? matchLength - MinMatch : 0;
+		*token = static_cast<std::uint8_t>(((literalLength < 15 ? literalLength : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+
+		if (literalLength >= 15)
+		{
+			out = WriteLength(out, literalLength - 15);
+		}
+		std::memcpy(out, literals, literalLength);
+		out += literalLength;
+
+		// Literal-only final sequence
+		if (matchLength == 0)
+		{
+			return out;
+		}
+
+		*out++ = static_cast<std::uint8_t>(offset & 0xFF);
+		*out++ = static_cast<std::uint8_t>(offset >> 8);
+		if (matchCode >= 15)
+		{
+			out = WriteLength(out, matchCode - 15);
+		}
+		return out;
+	}
+
+	std::size_t Lz4Block::Compress(const std::uint8_t* source, std::size_t sourceSize, std::uint8_t* dest)
+	{
+		std::uint8_t* out = dest;
+		std::size_t anchor = 0;
+
+		if (sourceSize > MatchSearchLimit)
+		{
+			// Position + 1 of the last occurrence of each hashed 4-byte sequence, 0 for none
+			std::vector<std::uint32_t> table(std::size_t(1) << HashBits, 0);
+			std::size_t matchEnd = sourceSize - LastLiterals;
+			std::size_t position = 0;
+
+			while (position < sourceSize - MatchSearchLimit)
+			{
+				std::uint32_t sequence = Read32(source + position);
+				std::uint32_t& slot = table[Hash(sequence)];
+				std::size_t candidate = slot;
+				slot = static_cast<std::uint32_t>(position + 1);
+
+				if (candidate == 0 || position - (candidate - 1) > MaxOffset || Read32(source + candidate - 1) != sequence)
+				{
+					++position;
+					continue;
+				}
+
+				std::size_t reference = candidate - 1;
+				std::size_t length = MinMatch;
+				while (position + length < matchEnd && source[reference + length] == source[position + length])
+				{
+					++length;
+				}
+
+				out = WriteSequence(out, source + anchor, position - anchor, position - reference, length);
+				position += length;
+				anchor = position;
+			}
+		}
+
+		out = WriteSequence(out, source + anchor, sourceSize - anchor, 0, 0);
+		return static_cast<std::size_t>(out - dest);
+	}
+
+	bool Lz4Block::Decompress(const std::uint8_t* source, std::size_t sourceSize, std::uint8_t* dest, std::size_t destSize)
+	{
+		const std::uint8_t* in = source;
+		const std::uint8_t* inEnd = source + sourceSize;
+		std::size_t written = 0;
+
+		// Reads the extra bytes of a length whose nibble was 15
+		auto readLength = [&](std::size_t& length) -> bool
+		{
+			std::uint8_t byte;
+			do
+			{
+				if (in >= inEnd)
+				{
+					return false;
+				}
+				byte = *in++;
+				length += byte;
+			} while (byte == 255);
+			return true;
+		};
+
+		while (in < inEnd)
+		{
+			std::uint8_t token = *in++;
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 15 && !readLength(literalLength))
+			{
+				return false;
+			}
+			if (literalLength > static_cast<std::size_t>(inEnd - in) || literalLength > destSize - written)
+			{
+				return false;
+			}
+			std::memcpy(dest + written, in, literalLength);
+			in += literalLength;
+			written += literalLength;
+
+			if (in == inEnd)
+			{
+				break;
+			}
+
+			if (inEnd - in < 2)
+			{
+				return false;
+			}
+			std::size_t offset = static_cast<std::size_t>(in[0]) | (static_cast<std::size_t>(in[1]) << 8);
+			in += 2;
+			if (offset == 0 || offset > written)
+			{
+				return false;
+			}
+
+			std::size_t matchLength = token & 0x0F;
+			if (matchLength == 15 && !readLength(matchLength))
+			{
+				return false;
+			}
+			matchLength += MinMatch;
+			if (matchLength > destSize - written)
+			{
+				return false;
+			}
+
+			// Byte by byte, the match may overlap the bytes it produces
+			const std::uint8_t* match = dest + written - offset;
+			for (std::size_t i = 0; i < matchLength; ++i)
+			{
+				dest[written + i] = match[i];
+			}
+			written += matchLength;
+		}
+		return written == destSize;
+	}
+}
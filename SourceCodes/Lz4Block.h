@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file Lz4Block.h
+///
+/// @brief Compressor and decompressor for the LZ4 block format, used for
+///        asset archive entries. The compressor is a single-pass greedy
+///        matcher (fast, moderate ratio); the decompressor is bounds checked
+///        so a damaged archive fails to load instead of overrunning.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _LZ4_BLOCK_H_
+#define _LZ4_BLOCK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Framework {
+
+	class Lz4Block
+	{
+	public:
+		// Worst case compressed size of sourceSize bytes
+		static std::size_t CompressBound(std::size_t sourceSize) { return sourceSize + sourceSize / 255 + 16; }
+
+		/**
+		 * @brief Compresses source into dest, which must hold CompressBound(sourceSize) bytes.
+		 *
+		 * @return the compressed size.
+		 */
+		static std::size_t Compress(const std::uint8_t* source, std::size_t sourceSize, std::uint8_t* dest);
+
+		/**
+		 * @brief Decompresses a block whose decompressed size is known up front.
+		 *
+		 * @return false if the block is malformed or does not decompress to exactly destSize bytes.
+		 */
+		static bool Decompress(const std::uint8_t* source, std::size_t sourceSize, std::uint8_t* dest, std::size_t destSize);
+	};
+}
+#endif // !_LZ4_BLOCK_H_
@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file MappedFile.h
+///
+/// @brief Read-only memory mapping of a whole file, so cooked assets can be
+///        handed to the GPU or parsed in place without being copied through
+///        stream buffers.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Framework {
+
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/**
+		 * @brief Maps the file read-only. Any previous mapping is closed first.
+		 *
+		 * @return false if the file does not exist, is empty or cannot be mapped.
+		 */
+		bool Open(const std::string& path);
+
+		void Close();
+
+		bool IsOpen() const { return data != nullptr; }
+		const std::uint8_t* Data() const { return data; }
+		std::size_t Size() const { return size; }
+
+	private:
+		const std::uint8_t* data = nullptr;
+		std::size_t size = 0;
+
+#ifdef _WIN32
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#else
+		int fileDescriptor = -1;
+#endif
+	};
+}
+#endif // !_MAPPED_FILE_H_
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file RenderTargetPool.cpp
+///
+/// @brief Size/format keyed render target pool with per-frame aging.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "RenderTargetPool.h"
+#include <algorithm>
+#include <iostream>
+#include "GraphicsStats.h"
+#include "imgui.h"
+
+namespace Framework {
+
+	std::vector<std::unique_ptr<RenderTarget>> RenderTargetPool::targets{};
+	std::size_t RenderTargetPool::totalBytes{};
+
+	// Bytes per texel of the color formats passes ask for
+	static std::size_t ColorBytesPerTexel(GLenum format)
+	{
+		switch (format)
+		{
+		case GL_R8:
+			return 1;
+		case GL_RG8:
+			return 2;
+		case GL_RGB8:
+			return 3;
+		case GL_RGBA16F:
+			return 8;
+		case GL_RGBA32F:
+			return 16;
+		case GL_RGBA8:
+		default:
+			return 4;
+		}
+	}
+
+	static const char* ColorFormatName(GLenum format)
+	{
+		switch (format)
+		{
+		case GL_R8:      return "R8";
+		case GL_RG8:     return "RG8";
+		case GL_RGB8:    return "RGB8";
+		case GL_RGBA8:   return "RGBA8";
+		case GL_RGBA16F: return "RGBA16F";
+		case GL_RGBA32F: return "RGBA32F";
+		default:         return "other";
+		}
+	}
+
+	RenderTarget* RenderTargetPool::Acquire(const RenderTargetDesc& desc)
+	{
+		for (auto& target : targets)
+		{
+			if (!target->inUse && target->desc == desc)
+			{
+				target->inUse = true;
+				target->unusedFrames = 0;
+				return target.get();
+			}
+		}
+
+		std::unique_ptr<RenderTarget> target = Create(desc);
+		if (!target)
+		{
+			return nullptr;
+		}
+		target->inUse = true;
+		totalBytes += target->bytes;
+		targets.push_back(std::move(target));
+		return targets.back().get();
+	}
+
+	void RenderTargetPool::Release(RenderTarget* target)
+	{
+		if (target != nullptr)
+		{
+			target->inUse = false;
+		}
+	}
+
+	void RenderTargetPool::EndFrame()
+	{
+		for (auto& target : targets)
+		{
+			target->unusedFrames = target->inUse ? 0 : target->unusedFrames + 1;
+		}
+
+		auto expired = std::remove_if(targets.begin(), targets.end(), [](const std::unique_ptr<RenderTarget>& target)
+		{
+			if (target->unusedFrames < UnusedFrameLimit)
+			{
+				return false;
+			}
+			totalBytes -= target->bytes;
+			Destroy(*target);
+			return true;
+		});
+		targets.erase(expired, targets.end());
+	}
+
+	void RenderTargetPool::Clear()
+	{
+		for (auto& target : targets)
+		{
+			Destroy(*target);
+		}
+		targets.clear();
+		totalBytes = 0;
+	}
+
+	std::unique_ptr<RenderTarget> RenderTargetPool::Create(const RenderTargetDesc& desc)
+	{
+		auto target = std::make_unique<RenderTarget>();
+		target->desc = desc;
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &target->colorTexture);
+		glTextureStorage2D(target->colorTexture, 1, desc.colorFormat, desc.width, desc.height);
+		glTextureParameteri(target->colorTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(target->colorTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(target->colorTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(target->colorTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		std::size_t colorBytes = static_cast<std::size_t>(desc.width) * desc.height * ColorBytesPerTexel(desc.colorFormat);
+		GraphicsStats::TrackTexture(target->colorTexture, colorBytes);
+		target->bytes = colorBytes;
+
+		glCreateFramebuffers(1, &target->framebuffer);
+		glNamedFramebufferTexture(target->framebuffer, GL_COLOR_ATTACHMENT0, target->colorTexture, 0);
+
+		if (desc.depthStencil)
+		{
+			glCreateRenderbuffers(1, &target->depthStencil);
+			glNamedRenderbufferStorage(target->depthStencil, GL_DEPTH24_STENCIL8, desc.width, desc.height);
+			glNamedFramebufferRenderbuffer(target->framebuffer, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target->depthStencil);
+			target->bytes += static_cast<std::size_t>(desc.width) * desc.height * 4;
+		}
+
+		if (glCheckNamedFramebufferStatus(target->framebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			std::cout << "Render target " << desc.width << "x" << desc.height << " " << ColorFormatName(desc.colorFormat)
+				<< " is not complete!" << std::endl;
+			Destroy(*target);
+			return nullptr;
+		}
+		return target;
+	}
+
+	void RenderTargetPool::Destroy(RenderTarget& target)
+	{
+		GraphicsStats::UntrackTexture(target.colorTexture);
+		glDeleteFramebuffers(1, &target.framebuffer);
+		glDeleteTextures(1, &target.colorTexture);
+		if (target.depthStencil != 0)
+		{
+			glDeleteRenderbuffers(1, &target.depthStencil);
+		}
+
+		target = RenderTarget{};
+	}
+
+	void RenderTargetPool::ShowImGui()
+	{
+		if (ImGui::CollapsingHeader("Render Target Pool", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			ImGui::Text("Targets: %zu (%.2f MB)", targets.size(), totalBytes / (1024.0 * 1024.0));
+			for (const auto& target : targets)
+			{
+				ImGui::BulletText("%dx%d %s%s - %s", target->desc.width, target->desc.height,
+					ColorFormatName(target->desc.colorFormat), target->desc.depthStencil ? " + D24S8" : "",
+					target->inUse ? "in use" : "free");
+			}
+		}
+	}
+}
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file RenderTargetPool.h
+///
+/// @brief Pool of offscreen render targets (FBO + color texture + optional
+///        depth/stencil renderbuffer) keyed by size and format. Passes such as
+///        picking and dynamic resolution acquire a target for the frame and
+///        release it when done, so targets are shared across passes and
+///        reused across frames instead of being allocated per pass.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _RENDER_TARGET_POOL_H_
+#define _RENDER_TARGET_POOL_H_
+
+#include <glew.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Framework {
+
+	struct RenderTargetDesc
+	{
+		int width = 0;
+		int height = 0;
+		GLenum colorFormat = GL_RGBA8;  // Sized internal format of the color texture
+		bool depthStencil = false;      // Adds a GL_DEPTH24_STENCIL8 renderbuffer
+
+		bool operator==(const RenderTargetDesc& other) const
+		{
+			return width == other.width && height == other.height
+				&& colorFormat == other.colorFormat && depthStencil == other.depthStencil;
+		}
+	};
+
+	struct RenderTarget
+	{
+		RenderTargetDesc desc{};
+		GLuint framebuffer = 0;
+		GLuint colorTexture = 0;
+		GLuint depthStencil = 0;
+		std::size_t bytes = 0;
+
+		// Pool bookkeeping
+		bool inUse = false;
+		int unusedFrames = 0;
+	};
+
+	class RenderTargetPool
+	{
+	public:
+		/**
+		 * @brief Hands out a free target matching desc, creating one if none is free.
+		 *
+		 * The target stays owned by the pool. Release it once the pass no longer
+		 * needs its contents, at the latest by the end of the frame.
+		 *
+		 * @return the target, or nullptr if the framebuffer could not be completed.
+		 */
+		static RenderTarget* Acquire(const RenderTargetDesc& desc);
+
+		/**
+		 * @brief Returns a target to the pool for other passes and later frames.
+		 */
+		static void Release(RenderTarget* target);
+
+		/**
+		 * @brief Ages free targets and destroys those unused for UnusedFrameLimit frames,
+		 *        e.g. targets of an old size after a resize. Called once at the end of Graphics::Update.
+		 */
+		static void EndFrame();
+
+		/**
+		 * @brief Destroys every target. Targets still acquired become invalid.
+		 */
+		static void Clear();
+
+		static std::size_t GetTargetCount() { return targets.size(); }
+		static std::size_t GetTotalBytes() { return totalBytes; }
+
+		/**
+		 * @brief Draws the pool contents inside the currently open ImGui window (DebugSystem panel).
+		 */
+		static void ShowImGui();
+
+		// Frames a free target is kept before it is destroyed
+		static constexpr int UnusedFrameLimit = 300;
+
+	private:
+		static std::unique_ptr<RenderTarget> Create(const RenderTargetDesc& desc);
+		// Deletes the GL objects, the caller keeps totalBytes in sync
+		static void Destroy(RenderTarget& target);
+
+		static std::vector<std::unique_ptr<RenderTarget>> targets;
+		static std::size_t totalBytes;
+	};
+}
+#endif // !_RENDER_TARGET_POOL_H_
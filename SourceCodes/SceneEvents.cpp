@@ -0,0 +1,35 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SceneEvents.cpp
+///
+/// @brief Scene switch bookkeeping shared by the transitions and the editor.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "SceneEvents.h"
+#include "Graphics.h"
+#include "ScenePreloader.h"
+#include "SequenceScheduler.h"
+#include "TagIndex.h"
+#include "TimerWheel.h"
+#include "TweenEngine.h"
+
+namespace Framework {
+
+	void SceneEvents::OnSceneLoaded(const std::string& scenePath)
+	{
+		// Entity ids of the old scene are reused by the new one
+		TweenEngine::Clear();
+		TimerWheel::Clear();
+		TagIndex::Clear();
+		ScenePreloader::OnSceneLoaded(scenePath);
+		SequenceScheduler::OnSceneLoaded(scenePath);
+
+		// A scene with as many entities as the last one is not caught by the viewport's entity count
+		Graphics::MarkSceneDirty();
+	}
+}
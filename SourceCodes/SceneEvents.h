@@ -0,0 +1,36 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SceneEvents.h
+///
+/// @brief One place for what has to happen whenever a different scene goes
+///        live: tweens, timers and tags of the old entity ids are dropped
+///        and the preloader and sequence scheduler learn the new scene (a
+///        late ScenePreloader::Begin for it is ignored, sequences waiting on
+///        SceneLoaded(path) resume), and the editor viewport is redrawn.
+///        Every path that replaces the loaded entities calls it right after
+///        loading: scene transitions (GoToScene), the editor's Open and
+///        Stop, and the headless benchmark's scene.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _SCENE_EVENTS_H_
+#define _SCENE_EVENTS_H_
+
+#include <string>
+
+namespace Framework {
+
+	class SceneEvents
+	{
+	public:
+		/**
+		 * @brief Reports that the entities of scenePath replaced the previous scene.
+		 */
+		static void OnSceneLoaded(const std::string& scenePath);
+	};
+}
+#endif // !_SCENE_EVENTS_H_
@@ -0,0 +1,415 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file ScenePreloader.cpp
+///
+/// @brief Scene texture scan, parallel decode and GL thread upload.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "ScenePreloader.h"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <unordered_set>
+#include "rapidjson/document.h"
+#include "stb_image.h"
+#include "AnimationStateMachine.h"
+#include "AssetArchive.h"
+#include "AssetManager.h"
+#include "GraphicsTextures.h"
+#include "JobPool.h"
+#include "SpriteFrames.h"
+#include "TextureResidency.h"
+#include "imgui.h"
+
+namespace Framework {
+
+	double ScenePreloader::uploadBudgetMs = 2.0;
+	std::vector<PreloadJob> ScenePreloader::jobs{};
+	std::atomic<std::size_t> ScenePreloader::queuedDecodes{};
+	std::atomic<bool> ScenePreloader::cancelled{};
+	std::atomic<std::size_t> ScenePreloader::decodedCount{};
+	std::atomic<std::int64_t> ScenePreloader::decodeEndNs{};
+	std::size_t ScenePreloader::uploadedCount{};
+	bool ScenePreloader::active{};
+	bool ScenePreloader::awaitingFirstFrame{};
+	ScenePreloader::Clock::time_point ScenePreloader::beginTime{};
+	ScenePreloader::Clock::time_point ScenePreloader::liveTime{};
+	SceneLoadReport ScenePreloader::current{};
+	std::string ScenePreloader::liveScene{};
+	std::vector<SceneLoadReport> ScenePreloader::reports{};
+
+	static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Component fields holding a texture asset name: textureID, backingTextureID, idleTextureID, ..., and particle textureName
+	static bool IsTextureField(const std::string& name)
+	{
+		static const std::string lowerSuffix = "textureID";
+		static const std::string upperSuffix = "TextureID";
+		auto endsWith = [&](const std::string& suffix)
+		{
+			return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+		};
+		return endsWith(lowerSuffix) || endsWith(upperSuffix) || name == "textureName";
+	}
+
+	struct SceneScan
+	{
+		std::unordered_set<std::string> textures;
+		std::unordered_set<std::string> visitedFiles;
+	};
+
+	static void ScanValue(const rapidjson::Value& value, SceneScan& scan, std::vector<std::string>& prefabs)
+	{
+		if (value.IsObject())
+		{
+			for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member)
+			{
+				std::string name = member->name.GetString();
+				if (member->value.IsString() && IsTextureField(name))
+				{
+					scan.textures.insert(member->value.GetString());
+				}
+				ScanValue(member->value, scan, prefabs);
+			}
+		}
+		else if (value.IsArray())
+		{
+			for (const rapidjson::Value& element : value.GetArray())
+			{
+				ScanValue(element, scan, prefabs);
+			}
+		}
+		else if (value.IsString())
+		{
+			// Prefabs are referenced by bare file name, e.g. "BossBar.json"; full paths name other scenes
+			std::string text = value.GetString();
+			if (text.size() > 5 && text.compare(text.size() - 5, 5, ".json") == 0 && text.find_first_of("/\\") == std::string::npos)
+			{
+				prefabs.push_back("Assets/Prefabs/" + text);
+			}
+		}
+	}
+
+	static void ScanFile(const std::string& path, SceneScan& scan)
+	{
+		if (!scan.visitedFiles.insert(AssetArchive::NormalizePath(path)).second)
+		{
+			return;
+		}
+
+		AssetData file;
+		if (!AssetArchive::Open(path, file))
+		{
+			return;
+		}
+
+		rapidjson::Document document;
+		document.Parse(reinterpret_cast<const char*>(file.Data()), file.Size());
+		if (document.HasParseError())
+		{
+			return;
+		}
+
+		std::vector<std::string> prefabs;
+		ScanValue(document, scan, prefabs);
+		for (const std::string& prefab : prefabs)
+		{
+			if (AssetArchive::Exists(prefab))
+			{
+				ScanFile(prefab, scan);
+			}
+		}
+	}
+
+	void ScenePreloader::Begin(const std::string& scenePath)
+	{
+		if (active)
+		{
+			if (current.scene == scenePath)
+			{
+				return;
+			}
+			Cancel();
+		}
+		else if (scenePath == liveScene)
+		{
+			return;
+		}
+		liveScene.clear();
+
+		beginTime = Clock::now();
+		current = SceneLoadReport{};
+		current.scene = scenePath;
+		active = true;
+
+		SceneScan scan;
+		ScanFile(scenePath, scan);
+
+		// Animated entities can switch to any sheet of their state machine (hit, death), not only the one saved in the scene
+		std::vector<std::string> sceneSheets(scan.textures.begin(), scan.textures.end());
+		for (const std::string& sheet : sceneSheets)
+		{
+			AnimationStateMachines::CollectMachineSheets(sheet, scan.textures);
+		}
+
+		auto& textureAssets = GlobalAssetManager.UE_GetAllTextureAssets();
+		std::vector<std::string> pending;
+		for (const std::string& name : scan.textures)
+		{
+			auto asset = textureAssets.find(name);
+			if (asset == textureAssets.end())
+			{
+				continue;
+			}
+			if (TextureResidency::IsResident(name) || asset->second.textureID != 0)
+			{
+				++current.residentCount;
+				continue;
+			}
+			pending.push_back(name);
+		}
+
+		// Paths are resolved here, the workers do not read the asset or sprite frame maps
+		jobs = std::vector<PreloadJob>(pending.size());
+		for (std::size_t i = 0; i < pending.size(); ++i)
+		{
+			const std::string& assetPath = textureAssets.find(pending[i])->second.path;
+			jobs[i].name = pending[i];
+			jobs[i].sourcePath = assetPath;
+			jobs[i].cookedPath = CookedTexture::CookedPathFor(SpriteFrames::SourcePathOf(pending[i], assetPath));
+		}
+		cancelled = false;
+		decodedCount = 0;
+		decodeEndNs = 0;
+		uploadedCount = 0;
+		current.scanMs = MillisecondsSince(beginTime);
+
+		// Decoded on the engine's worker threads, the GL thread keeps rendering the transition
+		queuedDecodes = jobs.size();
+		for (std::size_t index = 0; index < jobs.size(); ++index)
+		{
+			JobPool::Push({ DecodeJob, nullptr, static_cast<std::uint32_t>(index) });
+		}
+		current.workerCount = std::max(1u, JobPool::GetThreadCount()) - 1;
+	}
+
+	void ScenePreloader::DecodeJob(void*, std::uint32_t index)
+	{
+		if (!cancelled)
+		{
+			PreloadJob& job = jobs[index];
+
+			// A cooked texture needs no decode, touching its pages moves the disk reads off the GL thread
+			if (job.cooked.Open(job.cookedPath, job.sourcePath))
+			{
+				job.isCooked = true;
+				volatile std::uint32_t checksum = 0;
+				for (std::uint32_t level = 0; level < job.cooked.Header().mipCount; ++level)
+				{
+					const std::uint8_t* data = job.cooked.MipData(level);
+					for (std::uint64_t offset = 0; offset < job.cooked.Mip(level).size; offset += 4096)
+					{
+						checksum = checksum + data[offset];
+					}
+				}
+			}
+			else
+			{
+				AssetData source;
+				int channels = 0;
+				if (AssetArchive::Open(job.sourcePath, source))
+				{
+					job.pixels = stbi_load_from_memory(source.Data(), static_cast<int>(source.Size()), &job.width, &job.height, &channels, 4);
+				}
+				job.failed = (job.pixels == nullptr);
+			}
+
+			job.decoded.store(true, std::memory_order_release);
+			if (++decodedCount == jobs.size())
+			{
+				decodeEndNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - beginTime).count();
+			}
+		}
+		--queuedDecodes;
+	}
+
+	std::size_t ScenePreloader::UploadJobs(double budgetMs)
+	{
+		Clock::time_point start = Clock::now();
+		std::size_t uploaded = 0;
+		for (PreloadJob& job : jobs)
+		{
+			if (job.uploaded || !job.decoded.load(std::memory_order_acquire))
+			{
+				continue;
+			}
+			if (budgetMs > 0.0 && MillisecondsSince(start) >= budgetMs)
+			{
+				break;
+			}
+
+			job.uploaded = true;
+			++uploadedCount;
+			if (!job.failed && !TextureResidency::IsResident(job.name))
+			{
+				LoadedTexture texture = job.isCooked
+					? GraphicsTextures::Upload(job.cooked)
+					: GraphicsTextures::CreateTexture(job.width, job.height, job.pixels);
+				if (TextureResidency::Adopt(job.name, texture))
+				{
+					++current.textureCount;
+
+					// The grid image was decoded, its frames need grid UVs
+					if (!job.isCooked)
+					{
+						SpriteFrames::Remove(job.name);
+					}
+				}
+			}
+
+			if (job.pixels)
+			{
+				stbi_image_free(job.pixels);
+				job.pixels = nullptr;
+			}
+			++uploaded;
+		}
+		current.uploadMs += MillisecondsSince(start);
+		return uploaded;
+	}
+
+	void ScenePreloader::Update()
+	{
+		if (!active)
+		{
+			return;
+		}
+
+		UploadJobs(uploadBudgetMs);
+	}
+
+	void ScenePreloader::Finish(const std::string& scenePath)
+	{
+		// Switching to the scene, even the live one, always loads it
+		liveScene.clear();
+		Begin(scenePath);
+
+		WaitForDecodes();
+		UploadJobs(0.0);
+
+		current.decodeMs = decodeEndNs / 1.0e6;
+		current.loadMs = MillisecondsSince(beginTime);
+		jobs.clear();
+		active = false;
+
+		liveTime = Clock::now();
+		awaitingFirstFrame = true;
+	}
+
+	void ScenePreloader::EndFrame()
+	{
+		if (!awaitingFirstFrame)
+		{
+			return;
+		}
+		awaitingFirstFrame = false;
+		current.firstFrameMs = MillisecondsSince(liveTime);
+
+		std::cout << "Scene " << current.scene << " loaded: " << current.textureCount << " textures preloaded on "
+			<< current.workerCount << " workers, load " << current.loadMs << " ms, first interactive frame after "
+			<< current.firstFrameMs << " ms" << std::endl;
+
+		reports.push_back(current);
+		if (reports.size() > MaxReports)
+		{
+			reports.erase(reports.begin());
+		}
+	}
+
+	void ScenePreloader::WaitForDecodes()
+	{
+		// The calling thread decodes too instead of idling; what is left runs on a worker for a moment
+		while (queuedDecodes > 0)
+		{
+			if (!JobPool::RunOne())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void ScenePreloader::Cancel()
+	{
+		// Queued decodes are skipped, the ones already running finish and are dropped
+		cancelled = true;
+		WaitForDecodes();
+		for (PreloadJob& job : jobs)
+		{
+			if (job.pixels)
+			{
+				stbi_image_free(job.pixels);
+			}
+		}
+		jobs.clear();
+		active = false;
+	}
+
+	void ScenePreloader::ShowImGui()
+	{
+		if (ImGui::CollapsingHeader("Scene Loading"))
+		{
+			if (active)
+			{
+				ImGui::Text("Preloading %s: %zu / %zu decoded, %zu uploaded", current.scene.c_str(),
+					decodedCount.load(), jobs.size(), uploadedCount);
+			}
+			else
+			{
+				ImGui::TextUnformatted("No scene preloading");
+			}
+			float budget = static_cast<float>(uploadBudgetMs);
+			if (ImGui::SliderFloat("Upload Budget (ms/frame)", &budget, 0.5f, 8.0f))
+			{
+				uploadBudgetMs = budget;
+			}
+
+			if (ImGui::BeginTable("SceneLoads", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+			{
+				ImGui::TableSetupColumn("Scene");
+				ImGui::TableSetupColumn("Textures");
+				ImGui::TableSetupColumn("Decode (ms)");
+				ImGui::TableSetupColumn("Upload (ms)");
+				ImGui::TableSetupColumn("Load (ms)");
+				ImGui::TableSetupColumn("First Frame (ms)");
+				ImGui::TableHeadersRow();
+
+				// Newest first
+				for (auto report = reports.rbegin(); report != reports.rend(); ++report)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0);
+					ImGui::TextUnformatted(report->scene.c_str());
+					ImGui::TableSetColumnIndex(1);
+					ImGui::Text("%zu (+%zu resident)", report->textureCount, report->residentCount);
+					ImGui::TableSetColumnIndex(2);
+					ImGui::Text("%.1f", report->decodeMs);
+					ImGui::TableSetColumnIndex(3);
+					ImGui::Text("%.1f", report->uploadMs);
+					ImGui::TableSetColumnIndex(4);
+					ImGui::Text("%.1f", report->loadMs);
+					ImGui::TableSetColumnIndex(5);
+					ImGui::Text("%.1f", report->firstFrameMs);
+				}
+				ImGui::EndTable();
+			}
+		}
+	}
+}
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file ScenePreloader.h
+///
+/// @brief Loads the textures of the next scene before it goes live. The scene
+///        JSON (and prefabs it names) is scanned for texture references,
+///        JobPool workers decode the images while the transition timeline
+///        plays, and the GL thread uploads finished decodes a few per frame,
+///        then the rest when the scene is switched in. Each load is timed,
+///        from Begin to the scene going live and on to the end of its first
+///        frame.
+///
+///        Usage from a transition:
+///          ScenePreloader::Begin(nextScene);   // every frame while it plays, repeat calls are free
+///          ScenePreloader::Finish(nextScene);  // right before GlobalSceneManager.TransitionToScene
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _SCENE_PRELOADER_H_
+#define _SCENE_PRELOADER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CookedTexture.h"
+
+namespace Framework {
+
+	// One texture being preloaded, decoded by a worker and uploaded on the GL thread
+	struct PreloadJob
+	{
+		std::string name;
+		std::string sourcePath;         // The asset's image, decoded when there is no usable cooked file
+		std::string cookedPath;         // Of the trimmed atlas for a trimmed sheet
+		CookedTexture cooked;
+		bool isCooked = false;
+		std::uint8_t* pixels = nullptr; // stb_image decode when there is no cooked file
+		int width = 0;
+		int height = 0;
+		bool failed = false;            // Left to the regular lazy load
+		bool uploaded = false;
+		std::atomic<bool> decoded{ false };
+	};
+
+	struct SceneLoadReport
+	{
+		std::string scene;
+		std::size_t textureCount = 0;   // Preloaded by this load
+		std::size_t residentCount = 0;  // Referenced but already in VRAM
+		unsigned workerCount = 0;
+		double scanMs = 0.0;
+		double decodeMs = 0.0;          // Begin until the last worker finished
+		double uploadMs = 0.0;          // GL thread time spent uploading
+		double loadMs = 0.0;            // Begin until the scene went live
+		double firstFrameMs = 0.0;      // Scene live until the end of its first frame
+	};
+
+	class ScenePreloader
+	{
+	public:
+		/**
+		 * @brief Scans a scene for textures that are not resident and queues their decodes on the JobPool.
+		 *        Calling it again for the scene already being preloaded does nothing, nor does calling it
+		 *        for the scene that is live (a transition still ticking after its switch) until another
+		 *        scene is requested; a different scene cancels the current preload.
+		 */
+		static void Begin(const std::string& scenePath);
+
+		/**
+		 * @brief Uploads decoded textures for up to uploadBudgetMs. Called every frame by Graphics::Update.
+		 */
+		static void Update();
+
+		/**
+		 * @brief Waits for the decodes, helping with them, and uploads everything left, then records the scene as live.
+		 *        Starts (and completes) the preload if Begin was not called for this scene, also when reloading the live scene.
+		 */
+		static void Finish(const std::string& scenePath);
+
+		/**
+		 * @brief Remembers the scene that went live, so Begin ignores it. Called by SceneEvents::OnSceneLoaded.
+		 */
+		static void OnSceneLoaded(const std::string& scenePath) { liveScene = scenePath; }
+
+		/**
+		 * @brief Completes the report of a scene that went live this frame. Called at the end of Graphics::Update.
+		 */
+		static void EndFrame();
+
+		static bool IsPreloading() { return active; }
+
+		// Completed loads, oldest first, at most MaxReports
+		static const std::vector<SceneLoadReport>& GetReports() { return reports; }
+
+		/**
+		 * @brief Draws the current preload and recent load times inside the currently open ImGui window (DebugSystem panel).
+		 */
+		static void ShowImGui();
+
+		// GL thread time per frame spent uploading while the transition plays
+		static double uploadBudgetMs;
+
+		static constexpr std::size_t MaxReports = 16;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		static void DecodeJob(void* context, std::uint32_t index);
+		static std::size_t UploadJobs(double budgetMs);
+		static void WaitForDecodes();
+		static void Cancel();
+
+		static std::vector<PreloadJob> jobs;
+		static std::atomic<std::size_t> queuedDecodes;  // Pushed to the JobPool and not finished or skipped yet
+		static std::atomic<bool> cancelled;             // Queued decodes skip their work
+		static std::atomic<std::size_t> decodedCount;
+		static std::atomic<std::int64_t> decodeEndNs;   // Since beginTime, written by the last worker
+		static std::size_t uploadedCount;
+
+		static bool active;
+		static bool awaitingFirstFrame;
+		static Clock::time_point beginTime;
+		static Clock::time_point liveTime;
+		static SceneLoadReport current;
+		static std::string liveScene;
+		static std::vector<SceneLoadReport> reports;
+	};
+}
+#endif // !_SCENE_PRELOADER_H_
@@ -0,0 +1,342 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SequenceScheduler.cpp
+///
+/// @brief Sequence slots, resumption from timers, tweens and scene loads,
+///        and the coroutine frame pool.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "SequenceScheduler.h"
+#include <iostream>
+#include <new>
+
+namespace Framework {
+
+	std::array<std::vector<void*>, SequenceFramePool::BlockSizes.size()> SequenceFramePool::freeBlocks{};
+	std::vector<void*> SequenceFramePool::chunks{};
+	std::size_t SequenceFramePool::liveCount{};
+
+	std::vector<SequenceScheduler::Slot> SequenceScheduler::slots{};
+	std::vector<std::uint32_t> SequenceScheduler::freeSlots{};
+	std::unordered_map<std::string, SequenceFactory> SequenceScheduler::factories{};
+	std::string SequenceScheduler::currentScene{};
+
+	/*  Frame pool
+	----------------------------------------------------------------------------- */
+	static std::size_t BlockClassOf(std::size_t size)
+	{
+		std::size_t blockClass = 0;
+		while (blockClass < SequenceFramePool::BlockSizes.size() && SequenceFramePool::BlockSizes[blockClass] < size)
+		{
+			++blockClass;
+		}
+		return blockClass;
+	}
+
+	void* SequenceFramePool::Allocate(std::size_t size)
+	{
+		++liveCount;
+		std::size_t blockClass = BlockClassOf(size);
+		if (blockClass == BlockSizes.size())
+		{
+			return ::operator new(size);
+		}
+
+		std::vector<void*>& blocks = freeBlocks[blockClass];
+		if (blocks.empty())
+		{
+			std::size_t blockSize = BlockSizes[blockClass];
+			char* chunk = static_cast<char*>(::operator new(blockSize * BlocksPerChunk));
+			chunks.push_back(chunk);
+			blocks.reserve(blocks.size() + BlocksPerChunk);
+			for (std::size_t block = BlocksPerChunk; block-- > 0;)
+			{
+				blocks.push_back(chunk + block * blockSize);
+			}
+		}
+		void* frame = blocks.back();
+		blocks.pop_back();
+		return frame;
+	}
+
+	void SequenceFramePool::Release(void* frame, std::size_t size)
+	{
+		--liveCount;
+		std::size_t blockClass = BlockClassOf(size);
+		if (blockClass == BlockSizes.size())
+		{
+			::operator delete(frame);
+			return;
+		}
+		freeBlocks[blockClass].push_back(frame);
+	}
+
+	/*  Awaiters
+	----------------------------------------------------------------------------- */
+	void SecondsAwaiter::await_suspend(SequenceCoroutine coroutine) const
+	{
+		std::uint32_t index = coroutine.promise().slot;
+		SequenceScheduler::Slot& slot = SequenceScheduler::slots[index];
+		slot.wait = SequenceScheduler::Wait::Timer;
+		slot.clock = clock;
+		if (slot.paused)
+		{
+			// Scheduled when it is unpaused
+			slot.timerRemaining = seconds;
+			return;
+		}
+		slot.timer = TimerWheel::Schedule(clock, seconds, slot.entity, SequenceScheduler::ResumeFromTimer, index);
+	}
+
+	void TweenAwaiter::await_suspend(SequenceCoroutine coroutine) const
+	{
+		std::uint32_t index = coroutine.promise().slot;
+		SequenceScheduler::Slot& slot = SequenceScheduler::slots[index];
+		slot.wait = SequenceScheduler::Wait::Tween;
+		slot.tween = TweenEngine::Play(entity, *preset, params, SequenceScheduler::ResumeFromTween, index);
+	}
+
+	void SceneLoadedAwaiter::await_suspend(SequenceCoroutine coroutine) const
+	{
+		SequenceScheduler::Slot& slot = SequenceScheduler::slots[coroutine.promise().slot];
+		slot.wait = SequenceScheduler::Wait::Scene;
+		slot.scene = scene;
+	}
+
+	TweenAwaiter Tween(Entity entity, const std::string& preset, const TweenParams& params)
+	{
+		const TweenPreset* found = TweenEngine::FindPreset(preset);
+		if (!found)
+		{
+			std::cerr << "Sequence: no tween preset named '" << preset << "', not waiting for it" << std::endl;
+		}
+		return { entity, found, params };
+	}
+
+	/*  Scheduler
+	----------------------------------------------------------------------------- */
+	SequenceHandle SequenceScheduler::Start(Sequence sequence, Entity entity, SequenceCallback onDone, std::uint32_t event)
+	{
+		if (!sequence.handle)
+		{
+			return {};
+		}
+
+		std::uint32_t index = 0;
+		if (!freeSlots.empty())
+		{
+			index = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else
+		{
+			index = static_cast<std::uint32_t>(slots.size());
+			slots.emplace_back();
+		}
+
+		Slot& slot = slots[index];
+		slot.coroutine = sequence.handle;
+		sequence.handle = nullptr;
+		slot.coroutine.promise().slot = index;
+		slot.entity = entity;
+		slot.onDone = onDone;
+		slot.event = event;
+		slot.used = true;
+
+		SequenceHandle handle{ index, slot.generation };
+		Resume(index);
+		return handle;
+	}
+
+	void SequenceScheduler::Resume(std::uint32_t index)
+	{
+		SequenceCoroutine coroutine = slots[index].coroutine;
+		slots[index].wait = Wait::None;
+		slots[index].running = true;
+
+		// The sequence may start others, so the slot is looked up again afterwards
+		coroutine.resume();
+
+		Slot& slot = slots[index];
+		slot.running = false;
+		if (!coroutine.done() && !slot.cancelled)
+		{
+			return;
+		}
+
+		bool finished = !slot.cancelled;
+		Entity entity = slot.entity;
+		SequenceCallback onDone = slot.onDone;
+		std::uint32_t event = slot.event;
+		Destroy(index);
+		if (finished && onDone)
+		{
+			onDone(entity, event);
+		}
+	}
+
+	void SequenceScheduler::Destroy(std::uint32_t index)
+	{
+		Slot& slot = slots[index];
+		if (slot.wait == Wait::Timer)
+		{
+			TimerWheel::Cancel(slot.timer);
+		}
+		else if (slot.wait == Wait::Tween)
+		{
+			TweenEngine::Stop(slot.tween);
+		}
+		slot.coroutine.destroy();
+
+		slot.coroutine = nullptr;
+		++slot.generation;
+		slot.onDone = nullptr;
+		slot.wait = Wait::None;
+		slot.scene.clear();
+		slot.used = false;
+		slot.cancelled = false;
+		slot.paused = false;
+		slot.wakePending = false;
+		freeSlots.push_back(index);
+	}
+
+	void SequenceScheduler::ResumeFromTimer(Entity, std::uint32_t index)
+	{
+		Resume(index);
+	}
+
+	void SequenceScheduler::ResumeFromTween(Entity, std::uint32_t index)
+	{
+		if (slots[index].paused)
+		{
+			slots[index].wakePending = true;
+			return;
+		}
+		Resume(index);
+	}
+
+	void SequenceScheduler::Stop(SequenceHandle handle)
+	{
+		if (!IsRunning(handle))
+		{
+			return;
+		}
+		if (slots[handle.index].running)
+		{
+			slots[handle.index].cancelled = true;
+			return;
+		}
+		Destroy(handle.index);
+	}
+
+	void SequenceScheduler::SetPaused(SequenceHandle handle, bool paused)
+	{
+		if (!IsRunning(handle) || slots[handle.index].paused == paused)
+		{
+			return;
+		}
+		Slot& slot = slots[handle.index];
+		slot.paused = paused;
+		if (paused)
+		{
+			if (slot.wait == Wait::Timer)
+			{
+				slot.timerRemaining = TimerWheel::Remaining(slot.timer);
+				TimerWheel::Cancel(slot.timer);
+			}
+			return;
+		}
+
+		if (slot.wait == Wait::Timer)
+		{
+			slot.timer = TimerWheel::Schedule(slot.clock, slot.timerRemaining, slot.entity, ResumeFromTimer, handle.index);
+		}
+		else if (slot.wakePending)
+		{
+			slot.wakePending = false;
+			Resume(handle.index);
+		}
+	}
+
+	bool SequenceScheduler::IsRunning(SequenceHandle handle)
+	{
+		return handle.index < slots.size() && slots[handle.index].used && slots[handle.index].generation == handle.generation;
+	}
+
+	void SequenceScheduler::OnSceneLoaded(const std::string& scene)
+	{
+		currentScene = scene;
+
+		// Resumed in slot order once every slot is settled, as a resumed sequence may start or stop others
+		static std::vector<SequenceHandle> waking;
+		std::vector<SequenceHandle> resume;
+		resume.swap(waking);
+		for (std::uint32_t index = 0; index < slots.size(); ++index)
+		{
+			Slot& slot = slots[index];
+			if (!slot.used)
+			{
+				continue;
+			}
+			if (slot.wait == Wait::Timer || slot.wait == Wait::Tween)
+			{
+				Destroy(index);
+				continue;
+			}
+
+			// Its entity belongs to the old scene, and no timeline holds it any more
+			++slot.generation;
+			slot.onDone = nullptr;
+			slot.paused = false;
+			if (slot.wait == Wait::Scene && slot.scene == scene)
+			{
+				resume.push_back({ index, slot.generation });
+			}
+		}
+
+		for (SequenceHandle handle : resume)
+		{
+			if (IsRunning(handle) && slots[handle.index].wait == Wait::Scene)
+			{
+				Resume(handle.index);
+			}
+		}
+		resume.clear();
+		waking.swap(resume);
+	}
+
+	void SequenceScheduler::Clear()
+	{
+		for (std::uint32_t index = 0; index < slots.size(); ++index)
+		{
+			Slot& slot = slots[index];
+			if (!slot.used)
+			{
+				continue;
+			}
+			if (slot.running)
+			{
+				++slot.generation;
+				slot.cancelled = true;
+				continue;
+			}
+			Destroy(index);
+		}
+	}
+
+	void SequenceScheduler::Register(const std::string& name, SequenceFactory factory)
+	{
+		factories[name] = factory;
+	}
+
+	SequenceFactory SequenceScheduler::Find(const std::string& name)
+	{
+		auto found = factories.find(name);
+		return (found != factories.end()) ? found->second : nullptr;
+	}
+}
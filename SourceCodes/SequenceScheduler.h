@@ -0,0 +1,249 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SequenceScheduler.h
+///
+/// @brief Scripted sequences as C++20 coroutines. A sequence is written as
+///        straight-line code and suspends on what it waits for:
+///
+///          Sequence BossWarning(Entity entity)
+///          {
+///              co_await Tween(entity, "BlinkingNoSpawn", { 4.0f });
+///              co_await Seconds(0.5f);
+///              GlobalAssetManager.UE_LoadPrefab("BossBar.json");
+///          }
+///
+///        The timer wheel and the tween engine resume a suspended sequence
+///        from their own callbacks, so a waiting sequence is not visited at
+///        all until then. Coroutine frames come from pooled blocks, a
+///        sequence only allocates when its frame is larger than the biggest
+///        block.
+///
+///        On a scene change (SceneEvents::OnSceneLoaded, called by every
+///        scene load) sequences waiting on a timer or tween are dropped with
+///        the scene; the others carry on into the new scene, detached from
+///        the entity that started them.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _SEQUENCE_SCHEDULER_H_
+#define _SEQUENCE_SCHEDULER_H_
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ComponentList.h"
+#include "TimerWheel.h"
+#include "TweenEngine.h"
+
+namespace Framework {
+
+	// Fixed-size blocks for coroutine frames, kept for reuse once released
+	class SequenceFramePool
+	{
+	public:
+		static void* Allocate(std::size_t size);
+		static void Release(void* frame, std::size_t size);
+
+		// Blocks handed out, pooled or not
+		static std::size_t GetLiveCount() { return liveCount; }
+
+		static constexpr std::array<std::size_t, 4> BlockSizes{ 256, 512, 1024, 2048 };
+		static constexpr std::size_t BlocksPerChunk = 32;
+
+	private:
+		static std::array<std::vector<void*>, BlockSizes.size()> freeBlocks;
+		static std::vector<void*> chunks;
+		static std::size_t liveCount;
+	};
+
+	class Sequence
+	{
+	public:
+		struct promise_type
+		{
+			std::uint32_t slot = ~0u;   // Set by SequenceScheduler::Start
+
+			Sequence get_return_object() { return Sequence(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() {}
+			void unhandled_exception() { std::terminate(); }
+
+			static void* operator new(std::size_t size) { return SequenceFramePool::Allocate(size); }
+			static void operator delete(void* frame, std::size_t size) { SequenceFramePool::Release(frame, size); }
+		};
+
+		Sequence(Sequence&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+		Sequence(const Sequence&) = delete;
+		Sequence& operator=(const Sequence&) = delete;
+		Sequence& operator=(Sequence&&) = delete;
+
+		// A sequence never started is destroyed with its object
+		~Sequence()
+		{
+			if (handle)
+			{
+				handle.destroy();
+			}
+		}
+
+	private:
+		friend class SequenceScheduler;
+
+		explicit Sequence(std::coroutine_handle<promise_type> coroutine) : handle(coroutine) {}
+
+		std::coroutine_handle<promise_type> handle;
+	};
+
+	using SequenceCoroutine = std::coroutine_handle<Sequence::promise_type>;
+
+	// Called when a sequence runs to its end, not when it is stopped or dropped
+	using SequenceCallback = void (*)(Entity entity, std::uint32_t event);
+
+	// A sequence of a timeline, e.g. registered under the name a TimelineComponent refers to
+	using SequenceFactory = Sequence (*)(Entity entity);
+
+	// Generation checked, a handle of a finished, stopped or detached sequence is simply not running
+	struct SequenceHandle
+	{
+		std::uint32_t index = ~0u;
+		std::uint32_t generation = 0;
+	};
+
+	class SequenceScheduler
+	{
+	public:
+		/**
+		 * @brief Runs a sequence up to its first co_await.
+		 *
+		 * @param entity, event : passed to onDone, when the sequence reaches its end
+		 */
+		static SequenceHandle Start(Sequence sequence, Entity entity = 0, SequenceCallback onDone = nullptr, std::uint32_t event = 0);
+
+		// Destroys a sequence without calling onDone; a sequence stopping itself ends at its next co_await
+		static void Stop(SequenceHandle handle);
+
+		/**
+		 * @brief Holds a sequence where it waits, e.g. while its timeline is hidden or inactive: a timer it
+		 *        waits on stops counting down, a tween that finishes resumes it only once it is unpaused.
+		 */
+		static void SetPaused(SequenceHandle handle, bool paused);
+
+		static bool IsRunning(SequenceHandle handle);
+
+		/**
+		 * @brief Reports a scene switch: drops sequences waiting on timers or tweens of the old scene,
+		 *        detaches the others from their handles and resumes those waiting for this scene.
+		 *        Called by SceneEvents::OnSceneLoaded; until the first call no scene counts as loaded.
+		 */
+		static void OnSceneLoaded(const std::string& scene);
+
+		// Destroys every sequence, e.g. when leaving play mode
+		static void Clear();
+
+		static std::size_t GetRunningCount() { return slots.size() - freeSlots.size(); }
+
+		static void Register(const std::string& name, SequenceFactory factory);
+
+		// nullptr if no sequence has the name
+		static SequenceFactory Find(const std::string& name);
+
+	private:
+		friend struct SecondsAwaiter;
+		friend struct TweenAwaiter;
+		friend struct SceneLoadedAwaiter;
+
+		enum class Wait : std::uint8_t
+		{
+			None,       // Running, or about to be resumed
+			Timer,
+			Tween,
+			Scene
+		};
+
+		struct Slot
+		{
+			SequenceCoroutine coroutine;
+			std::uint32_t generation = 1;
+			Entity entity = 0;
+			SequenceCallback onDone = nullptr;
+			std::uint32_t event = 0;
+			Wait wait = Wait::None;
+			TimerHandle timer;
+			TimerClock clock = TimerClock::Gameplay;
+			float timerRemaining = 0.0f;    // Of the timer waited on, while paused
+			TweenHandle tween;
+			std::string scene;
+			bool used = false;
+			bool running = false;       // Inside resume
+			bool cancelled = false;     // Stopped while running, destroyed when it suspends
+			bool paused = false;
+			bool wakePending = false;   // Its tween finished while paused
+		};
+
+		static void Resume(std::uint32_t index);
+		static void Destroy(std::uint32_t index);
+		static void ResumeFromTimer(Entity entity, std::uint32_t index);
+		static void ResumeFromTween(Entity entity, std::uint32_t index);
+
+		static std::vector<Slot> slots;
+		static std::vector<std::uint32_t> freeSlots;
+		static std::unordered_map<std::string, SequenceFactory> factories;
+		static std::string currentScene;
+	};
+
+	struct SecondsAwaiter
+	{
+		float seconds;
+		TimerClock clock;
+
+		bool await_ready() const { return seconds <= 0.0f; }
+		void await_suspend(SequenceCoroutine coroutine) const;
+		void await_resume() const {}
+	};
+
+	struct TweenAwaiter
+	{
+		Entity entity;
+		const TweenPreset* preset;
+		TweenParams params;
+
+		bool await_ready() const { return preset == nullptr; }
+		void await_suspend(SequenceCoroutine coroutine) const;
+		void await_resume() const {}
+	};
+
+	struct SceneLoadedAwaiter
+	{
+		std::string scene;
+
+		bool await_ready() const { return SequenceScheduler::currentScene == scene; }
+		void await_suspend(SequenceCoroutine coroutine) const;
+		void await_resume() const {}
+	};
+
+	// co_await Seconds(1.5f): resumes once the clock has run for that long
+	inline SecondsAwaiter Seconds(float seconds, TimerClock clock = TimerClock::Gameplay)
+	{
+		return { seconds, clock };
+	}
+
+	// co_await Tween(entity, "FadeOut"): plays a registered preset and resumes when it finishes; a missing preset does not wait
+	TweenAwaiter Tween(Entity entity, const std::string& preset, const TweenParams& params = {});
+
+	// co_await SceneLoaded(path): resumes once the scene is live, at once if it already is
+	inline SceneLoadedAwaiter SceneLoaded(const std::string& scene)
+	{
+		return { scene };
+	}
+}
+#endif // !_SEQUENCE_SCHEDULER_H_
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SpriteFrames.cpp
+///
+/// @brief Loading trimmed frame metadata and resolving the frame to draw.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "SpriteFrames.h"
+#include <algorithm>
+#include <iostream>
+#include "rapidjson/document.h"
+#include "AssetArchive.h"
+#include "AssetManager.h"
+#include "CookedTexture.h"
+
+namespace Framework {
+
+	std::unordered_map<std::string, TrimmedSheet> SpriteFrames::sheets{};
+
+	// Reads an integer member, false if it is missing or not an integer
+	static bool ReadInt(const rapidjson::Value& json, const char* name, float& value)
+	{
+		if (!json.IsObject() || !json.HasMember(name) || !json[name].IsInt())
+		{
+			return false;
+		}
+		value = static_cast<float>(json[name].GetInt());
+		return true;
+	}
+
+	static bool ReadSheet(const rapidjson::Value& json, TrimmedSheet& sheet)
+	{
+		if (!json.HasMember("atlas") || !json["atlas"].IsString() || !json.HasMember("frames") || !json["frames"].IsArray()
+			|| !json.HasMember("sequence") || !json["sequence"].IsArray())
+		{
+			return false;
+		}
+
+		float atlasWidth = 0.0f, atlasHeight = 0.0f, cellWidth = 0.0f, cellHeight = 0.0f;
+		if (!ReadInt(json, "atlasWidth", atlasWidth) || !ReadInt(json, "atlasHeight", atlasHeight)
+			|| !ReadInt(json, "cellWidth", cellWidth) || !ReadInt(json, "cellHeight", cellHeight))
+		{
+			return false;
+		}
+		if (atlasWidth <= 0.0f || atlasHeight <= 0.0f || cellWidth <= 0.0f || cellHeight <= 0.0f)
+		{
+			return false;
+		}
+
+		sheet.atlasPath = json["atlas"].GetString();
+		for (const rapidjson::Value& frameJson : json["frames"].GetArray())
+		{
+			float x = 0.0f, y = 0.0f, width = 0.0f, height = 0.0f, offsetX = 0.0f, offsetY = 0.0f;
+			if (!ReadInt(frameJson, "x", x) || !ReadInt(frameJson, "y", y) || !ReadInt(frameJson, "w", width) || !ReadInt(frameJson, "h", height)
+				|| !ReadInt(frameJson, "offsetX", offsetX) || !ReadInt(frameJson, "offsetY", offsetY))
+			{
+				return false;
+			}
+
+			// Offsets count rows from the top of the cell, the same direction v runs in drawMeshWithAnimation
+			SpriteFrame frame;
+			frame.uvRect = glm::vec4(x / atlasWidth, y / atlasHeight, width / atlasWidth, height / atlasHeight);
+			frame.quadRect = glm::vec4(offsetX / cellWidth - 0.5f, offsetY / cellHeight - 0.5f, width / cellWidth, height / cellHeight);
+			sheet.frames.push_back(frame);
+		}
+
+		for (const rapidjson::Value& unique : json["sequence"].GetArray())
+		{
+			if (!unique.IsUint() || unique.GetUint() >= sheet.frames.size())
+			{
+				return false;
+			}
+			sheet.sequence.push_back(static_cast<std::uint16_t>(unique.GetUint()));
+		}
+		return !sheet.sequence.empty();
+	}
+
+	bool SpriteFrames::Load(const std::string& path)
+	{
+		Clear();
+
+		if (!AssetArchive::Exists(path))
+		{
+			return true;
+		}
+
+		AssetData file;
+		if (!AssetArchive::Open(path, file))
+		{
+			std::cout << "Cannot open " << path << " for trimmed sprite frames" << std::endl;
+			return false;
+		}
+
+		rapidjson::Document document;
+		document.Parse(reinterpret_cast<const char*>(file.Data()), file.Size());
+		if (document.HasParseError() || !document.IsObject() || !document.HasMember("sheets") || !document["sheets"].IsArray())
+		{
+			std::cout << path << " has no \"sheets\" array" << std::endl;
+			return false;
+		}
+
+		auto& textureAssets = GlobalAssetManager.UE_GetAllTextureAssets();
+		for (const rapidjson::Value& sheetJson : document["sheets"].GetArray())
+		{
+			if (!sheetJson.HasMember("name") || !sheetJson["name"].IsString())
+			{
+				continue;
+			}
+			std::string name = sheetJson["name"].GetString();
+
+			TrimmedSheet sheet;
+			if (!ReadSheet(sheetJson, sheet))
+			{
+				std::cout << "AnimationFrames: " << name << " is malformed, drawn from the grid" << std::endl;
+				continue;
+			}
+
+			// The grid texture would need grid UVs, so a sheet already in VRAM stays on the grid until the next run
+			auto asset = textureAssets.find(name);
+			if (asset == textureAssets.end() || asset->second.textureID != 0
+				|| !AssetArchive::Exists(CookedTexture::CookedPathFor(sheet.atlasPath)))
+			{
+				continue;
+			}
+			sheets.emplace(std::move(name), std::move(sheet));
+		}
+
+		std::cout << "Trimmed frames for " << sheets.size() << " animation sheets" << std::endl;
+		return true;
+	}
+
+	void SpriteFrames::Clear()
+	{
+		sheets.clear();
+	}
+
+	const TrimmedSheet* SpriteFrames::Find(const std::string& sheet)
+	{
+		auto found = sheets.find(sheet);
+		return (found != sheets.end()) ? &found->second : nullptr;
+	}
+
+	SpriteFrame SpriteFrames::FrameOf(const std::string& sheet, int frame, int cols, int rows)
+	{
+		if (!sheets.empty())
+		{
+			if (const TrimmedSheet* trimmed = Find(sheet))
+			{
+				std::size_t index = static_cast<std::size_t>(std::max(frame, 0)) % trimmed->sequence.size();
+				return trimmed->frames[trimmed->sequence[index]];
+			}
+		}
+
+		cols = std::max(1, cols);
+		rows = std::max(1, rows);
+		SpriteFrame cell;
+		cell.uvRect = glm::vec4(static_cast<float>(frame % cols) / cols, static_cast<float>(frame / cols) / rows, 1.0f / cols, 1.0f / rows);
+		return cell;
+	}
+}
@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SpriteFrames.h
+///
+/// @brief Trimmed animation frames imported by Tools/SpriteTrimmer. A trimmed
+///        sheet's texture is loaded from its packed atlas (SourcePathOf), and
+///        each grid frame maps to an atlas rect plus the part of the original
+///        cell it covers, so an animated sprite draws a quad around its
+///        opaque pixels only. Frames that repeat in the grid share one atlas
+///        rect. The texture asset keeps its own path, which the asset browser
+///        shows and scenes save.
+///
+///        Sheets that were not imported, or whose texture was already loaded
+///        from the grid, keep the uniform grid UVs.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _SPRITE_FRAMES_H_
+#define _SPRITE_FRAMES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <vec4.hpp>
+
+namespace Framework {
+
+	struct SpriteFrame
+	{
+		glm::vec4 uvRect{ 0.0f, 0.0f, 1.0f, 1.0f };         // u, v, width, height in the texture
+		glm::vec4 quadRect{ -0.5f, -0.5f, 1.0f, 1.0f };     // x, y, width, height within the unit quad of a whole cell
+
+		bool IsEmpty() const { return quadRect.z <= 0.0f || quadRect.w <= 0.0f; }
+	};
+
+	struct TrimmedSheet
+	{
+		std::string atlasPath;
+		std::vector<SpriteFrame> frames;        // Unique frames
+		std::vector<std::uint16_t> sequence;    // Grid frame -> unique frame
+	};
+
+	class SpriteFrames
+	{
+	public:
+		/**
+		 * @brief Loads AnimationFrames.json, skipping sheets whose cooked atlas is missing or whose texture
+		 *        is already in VRAM (uploaded from the grid).
+		 *
+		 * @return false if the file cannot be read; a missing file just leaves every sheet on the grid.
+		 */
+		static bool Load(const std::string& path);
+
+		static void Clear();
+
+		/**
+		 * @brief The frame of a sheet to draw: its trimmed rect when the sheet was imported,
+		 *        otherwise the full grid cell.
+		 */
+		static SpriteFrame FrameOf(const std::string& sheet, int frame, int cols, int rows);
+
+		static const TrimmedSheet* Find(const std::string& sheet);
+
+		// The image a texture asset is loaded from: the atlas of a trimmed sheet, otherwise the asset's own path
+		static const std::string& SourcePathOf(const std::string& sheet, const std::string& assetPath)
+		{
+			const TrimmedSheet* trimmed = sheets.empty() ? nullptr : Find(sheet);
+			return trimmed ? trimmed->atlasPath : assetPath;
+		}
+
+		// Puts a sheet back on the grid, e.g. when its atlas could not be read
+		static void Remove(const std::string& sheet) { sheets.erase(sheet); }
+
+		static std::size_t GetSheetCount() { return sheets.size(); }
+
+		// Where SpriteTrimmer puts the atlas of a sheet, e.g. Assets/Animation/Trimmed/Boss_Death.png (only its cooked file exists)
+		static std::string AtlasPathFor(const std::string& sourcePath)
+		{
+			std::size_t slash = sourcePath.find_last_of("/\\");
+			std::size_t nameStart = (slash == std::string::npos) ? 0 : slash + 1;
+			return sourcePath.substr(0, nameStart) + "Trimmed/" + sourcePath.substr(nameStart);
+		}
+
+	private:
+		static std::unordered_map<std::string, TrimmedSheet> sheets;
+	};
+}
+#endif // !_SPRITE_FRAMES_H_
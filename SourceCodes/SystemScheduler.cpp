@@ -0,0 +1,349 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SystemScheduler.cpp
+///
+/// @brief Dependency graph of the systems, the frame run over the JobPool,
+///        dispatch from the engine loop, deferred work, access checks and the
+///        per-thread timeline.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "SystemScheduler.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include "JobPool.h"
+#include "imgui.h"
+
+namespace Framework {
+
+	std::vector<std::unique_ptr<SystemScheduler::Node>> SystemScheduler::nodes{};
+	bool SystemScheduler::graphDirty{ true };
+	float SystemScheduler::frameDeltaTime{};
+	std::atomic<std::uint32_t> SystemScheduler::unfinished{ 0 };
+	std::atomic<bool> SystemScheduler::frameRunning{ false };
+	std::vector<std::function<void()>> SystemScheduler::deferred{};
+	std::mutex SystemScheduler::mainThreadMutex{};
+	std::vector<std::uint32_t> SystemScheduler::mainThreadReady{};
+	std::condition_variable SystemScheduler::mainThreadWake{};
+	std::vector<std::vector<SystemTiming>> SystemScheduler::threadTimelines{};
+	std::vector<SystemTiming> SystemScheduler::lastFrame{};
+	double SystemScheduler::lastFrameMs{};
+
+	static std::chrono::steady_clock::time_point frameStart{};
+
+	// System being updated on this thread, for CheckAccess
+	static thread_local std::uint32_t runningNode = ~0u;
+
+	void SystemScheduler::Add(ISystem* system, const SystemAccess& access)
+	{
+		for (const auto& node : nodes)
+		{
+			if (node->system == system)
+			{
+				return;
+			}
+		}
+
+		auto node = std::make_unique<Node>();
+		node->system = system;
+		node->name = system->GetName();
+		node->access = access;
+		nodes.push_back(std::move(node));
+		graphDirty = true;
+	}
+
+	void SystemScheduler::Clear()
+	{
+		nodes.clear();
+		lastFrame.clear();
+		graphDirty = true;
+	}
+
+	void SystemScheduler::SetWorkerCount(unsigned workerCount)
+	{
+		JobPool::Start(workerCount);
+	}
+
+	bool SystemScheduler::Conflicts(const SystemAccess& first, const SystemAccess& second)
+	{
+		if ((first.flags | second.flags) & SystemExclusive)
+		{
+			return true;
+		}
+		Signature shared = (first.writes & (second.reads | second.writes)) | (second.writes & first.reads);
+
+		// Both only touch some fields of these components, they share nothing there unless the fields overlap
+		Signature byField = shared & first.byField & second.byField;
+		if (byField.any() && (first.fields & second.fields) == 0)
+		{
+			shared &= ~byField;
+		}
+		return shared.any();
+	}
+
+	void SystemScheduler::BuildGraph()
+	{
+		for (auto& node : nodes)
+		{
+			node->dependents.clear();
+			node->dependencyCount = 0;
+		}
+
+		// Added order is the single-threaded order, so edges only go forward and the graph has no cycles
+		for (std::uint32_t later = 0; later < nodes.size(); ++later)
+		{
+			for (std::uint32_t earlier = 0; earlier < later; ++earlier)
+			{
+				if (Conflicts(nodes[earlier]->access, nodes[later]->access))
+				{
+					nodes[earlier]->dependents.push_back(later);
+					++nodes[later]->dependencyCount;
+				}
+			}
+		}
+		graphDirty = false;
+	}
+
+	void SystemScheduler::MakeReady(std::uint32_t node)
+	{
+		if (nodes[node]->access.flags & SystemMainThread)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mainThreadMutex);
+				mainThreadReady.push_back(node);
+			}
+			mainThreadWake.notify_one();
+			return;
+		}
+		JobPool::Push({ RunNode, nullptr, node });
+	}
+
+	void SystemScheduler::RunNode(void*, std::uint32_t index)
+	{
+		Node& node = *nodes[index];
+		unsigned thread = JobPool::GetThreadIndex();
+
+		runningNode = index;
+		auto start = std::chrono::steady_clock::now();
+		node.system->Update(frameDeltaTime);
+		auto end = std::chrono::steady_clock::now();
+		runningNode = ~0u;
+
+		threadTimelines[thread].push_back({ index, thread,
+			std::chrono::duration<double, std::milli>(start - frameStart).count(),
+			std::chrono::duration<double, std::milli>(end - frameStart).count() });
+
+		for (std::uint32_t dependent : node.dependents)
+		{
+			if (nodes[dependent]->waiting.fetch_sub(1) == 1)
+			{
+				MakeReady(dependent);
+			}
+		}
+		if (unfinished.fetch_sub(1) == 1)
+		{
+			// Taking the lock orders this before the main thread's check, so the wake-up is not lost
+			{
+				std::lock_guard<std::mutex> lock(mainThreadMutex);
+			}
+			mainThreadWake.notify_one();
+		}
+	}
+
+	void SystemScheduler::Run(float deltaTime)
+	{
+		if (nodes.empty())
+		{
+			return;
+		}
+		if (!JobPool::IsRunning())
+		{
+			JobPool::Start();
+		}
+		if (graphDirty)
+		{
+			BuildGraph();
+		}
+
+		threadTimelines.resize(JobPool::GetThreadCount());
+		for (std::vector<SystemTiming>& timeline : threadTimelines)
+		{
+			timeline.clear();
+		}
+
+		frameRunning = true;
+		frameDeltaTime = deltaTime;
+		frameStart = std::chrono::steady_clock::now();
+		unfinished = static_cast<std::uint32_t>(nodes.size());
+		for (auto& node : nodes)
+		{
+			node->waiting = node->dependencyCount;
+		}
+		for (std::uint32_t node = 0; node < nodes.size(); ++node)
+		{
+			if (nodes[node]->dependencyCount == 0)
+			{
+				MakeReady(node);
+			}
+		}
+
+		// The calling thread runs the main thread systems and helps with the rest until the frame is done
+		std::vector<std::uint32_t> ready;
+		while (unfinished > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mainThreadMutex);
+				ready.swap(mainThreadReady);
+			}
+			if (!ready.empty())
+			{
+				for (std::uint32_t node : ready)
+				{
+					RunNode(nullptr, node);
+				}
+				ready.clear();
+				continue;
+			}
+			if (JobPool::RunOne())
+			{
+				continue;
+			}
+
+			// Nothing to help with, the workers have what is left; sleep until a main thread system is ready or the frame ends
+			std::unique_lock<std::mutex> lock(mainThreadMutex);
+			mainThreadWake.wait(lock, [] { return unfinished == 0 || !mainThreadReady.empty(); });
+		}
+
+		frameRunning = false;
+		for (auto& node : nodes)
+		{
+			node->ranAhead = true;
+		}
+
+		// Every system is done, structural changes they asked for cannot race with anything now
+		std::vector<std::function<void()>> work;
+		{
+			std::lock_guard<std::mutex> lock(mainThreadMutex);
+			work.swap(deferred);
+		}
+		for (std::function<void()>& task : work)
+		{
+			task();
+		}
+
+		lastFrameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+		lastFrame.clear();
+		for (const std::vector<SystemTiming>& timeline : threadTimelines)
+		{
+			lastFrame.insert(lastFrame.end(), timeline.begin(), timeline.end());
+		}
+		std::sort(lastFrame.begin(), lastFrame.end(), [](const SystemTiming& a, const SystemTiming& b)
+		{
+			return a.startMs < b.startMs;
+		});
+	}
+
+	bool SystemScheduler::Dispatch(ISystem* system, float deltaTime)
+	{
+		if (frameRunning)
+		{
+			return false;
+		}
+		auto found = std::find_if(nodes.begin(), nodes.end(), [system](const std::unique_ptr<Node>& node)
+		{
+			return node->system == system;
+		});
+		if (found == nodes.end())
+		{
+			return false;
+		}
+
+		// The engine loop's own call for a system the frame already updated
+		Node& node = **found;
+		if (!node.ranAhead)
+		{
+			Run(deltaTime);
+		}
+		node.ranAhead = false;
+		return true;
+	}
+
+	void SystemScheduler::Defer(std::function<void()> work)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mainThreadMutex);
+			if (frameRunning)
+			{
+				deferred.push_back(std::move(work));
+				return;
+			}
+		}
+		work();
+	}
+
+	void SystemScheduler::CheckAccess(std::size_t component)
+	{
+		if (runningNode == ~0u)
+		{
+			return;
+		}
+
+		// Nothing runs beside an Exclusive system, it may touch anything
+		const Node& node = *nodes[runningNode];
+		if (node.access.flags & SystemExclusive)
+		{
+			return;
+		}
+		if (!(node.access.reads | node.access.writes).test(component))
+		{
+			std::cerr << "SystemScheduler: " << node.name << " accesses component " << component
+				<< " missing from its SystemAccess" << std::endl;
+			assert(false && "A system accessed a component it did not declare - it may race with systems running beside it");
+		}
+	}
+
+	void SystemScheduler::ShowImGui()
+	{
+		if (!ImGui::CollapsingHeader("System Schedule (last frame)"))
+		{
+			return;
+		}
+
+		unsigned threadCount = JobPool::GetThreadCount();
+		ImGui::Text("Frame: %.3f ms on %u threads", lastFrameMs, threadCount);
+		if (lastFrame.empty() || lastFrameMs <= 0.0)
+		{
+			return;
+		}
+
+		// One lane per thread, each system a bar from its start to its end
+		const float laneHeight = ImGui::GetTextLineHeightWithSpacing();
+		ImVec2 origin = ImGui::GetCursorScreenPos();
+		float width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		for (const SystemTiming& timing : lastFrame)
+		{
+			ImVec2 min(origin.x + width * static_cast<float>(timing.startMs / lastFrameMs), origin.y + laneHeight * timing.thread);
+			ImVec2 max(origin.x + width * static_cast<float>(timing.endMs / lastFrameMs), min.y + laneHeight - 2.0f);
+			max.x = std::max(max.x, min.x + 2.0f);
+
+			float hue = static_cast<float>(timing.system) / static_cast<float>(std::max<std::size_t>(nodes.size(), 1));
+			drawList->AddRectFilled(min, max, ImColor::HSV(hue, 0.6f, 0.8f));
+			drawList->PushClipRect(min, max, true);
+			drawList->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32_BLACK, nodes[timing.system]->name.c_str());
+			drawList->PopClipRect();
+
+			if (ImGui::IsMouseHoveringRect(min, max))
+			{
+				ImGui::SetTooltip("%s: %.3f ms on thread %u", nodes[timing.system]->name.c_str(), timing.endMs - timing.startMs, timing.thread);
+			}
+		}
+		ImGui::Dummy(ImVec2(width, laneHeight * threadCount));
+	}
+}
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SystemScheduler.h
+///
+/// @brief Runs a frame of systems in parallel where their data allows it.
+///        Each system declares the components it reads and writes:
+///
+///          static constexpr SystemAccess Access{
+///              SignatureOf<CollisionComponent>,                    // reads
+///              SignatureOf<AnimationComponent, RenderComponent> }; // writes
+///
+///        Systems add themselves in Initialize, so they are in the order the
+///        engine loop updates them. A system depends on every earlier one it
+///        conflicts with: one writes what the other reads or writes, or one
+///        of them is Exclusive. Systems that share a component but touch
+///        different fields of it declare those fields and do not conflict.
+///        Every frame the systems whose dependencies are done go to the
+///        JobPool, MainThread systems (GL, windows) stay on the thread
+///        calling Run.
+///
+///        The engine loop still calls each system's Update in turn. A
+///        scheduled system starts its Update with Dispatch: the first one
+///        called in a frame runs the whole frame through Run, the calls
+///        after it return at once.
+///
+///        In debug builds a view refresh or a CheckedGetComponent by a system
+///        checks that the system declared the component. Each frame's start
+///        and end time of every system, and the thread it ran on, are kept
+///        for the DebugSystem window.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _SYSTEM_SCHEDULER_H_
+#define _SYSTEM_SCHEDULER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "System.h"
+#include "ComponentTypes.h"
+
+namespace Framework {
+
+	enum SystemFlags : std::uint8_t
+	{
+		SystemNoFlags = 0,
+		SystemMainThread = 1 << 0,  // Calls GL or the window, runs on the thread calling Run
+		SystemExclusive = 1 << 1    // Creates or destroys entities, or touches engine state shared with every system; runs alone
+	};
+
+	// Fields of a component written by more than one system, declared so the writers can run side by side
+	enum ComponentField : std::uint32_t
+	{
+		FieldNone = 0,
+		FieldRenderSheet = 1 << 0,          // RenderComponent::textureID
+		FieldRenderAppearance = 1 << 1      // RenderComponent alpha, isActive and colour
+	};
+
+	struct SystemAccess
+	{
+		Signature reads;
+		Signature writes;
+		std::uint8_t flags = SystemNoFlags;
+		Signature byField;                  // Components of reads/writes the system only touches through the fields below
+		std::uint32_t fields = FieldNone;   // ComponentField bits it reads or writes in them
+	};
+
+	// One system's run in a frame
+	struct SystemTiming
+	{
+		std::uint32_t system = 0;   // Index in the order systems were added
+		unsigned thread = 0;        // JobPool thread index, 0 is the main thread
+		double startMs = 0.0;       // From the start of the frame
+		double endMs = 0.0;
+	};
+
+	class SystemScheduler
+	{
+	public:
+		// Adds a system after the ones already added, with what it declared; adding it again does nothing
+		static void Add(ISystem* system, const SystemAccess& access);
+
+		template <typename T>
+		static void Add(T* system)
+		{
+			Add(system, T::Access);
+		}
+
+		static void Clear();
+
+		// Updates every system once, returns when all have finished and the deferred work is done
+		static void Run(float deltaTime);
+
+		/**
+		 * @brief First call in the Update of a scheduled system. Called by the engine loop, the first system of
+		 *        the frame runs the frame through Run and every system returns true and skips its body; called
+		 *        by Run, it returns false and the system updates. Unscheduled systems always get false.
+		 */
+		static bool Dispatch(ISystem* system, float deltaTime);
+
+		/**
+		 * @brief Runs work that creates or destroys entities or changes engine state shared with other systems
+		 *        (scene loads, prefab spawns, pausing) on the main thread once the frame's systems are done.
+		 *        Outside a frame it runs at once.
+		 */
+		static void Defer(std::function<void()> work);
+
+		// Starts the JobPool with the given workers; Run starts it with the default count otherwise
+		static void SetWorkerCount(unsigned workerCount);
+
+		// Debug builds: reports a component the running system did not declare
+		static void CheckAccess(std::size_t component);
+
+		static std::size_t GetSystemCount() { return nodes.size(); }
+		static const std::string& GetSystemName(std::uint32_t system) { return nodes[system]->name; }
+
+		// Systems of the last frame, in the order they started
+		static const std::vector<SystemTiming>& GetLastFrameTimeline() { return lastFrame; }
+		static double GetLastFrameMs() { return lastFrameMs; }
+
+		/**
+		 * @brief Draws the last frame's per-thread timeline inside the currently open ImGui window (DebugSystem panel).
+		 */
+		static void ShowImGui();
+
+	private:
+		struct Node
+		{
+			ISystem* system = nullptr;
+			std::string name;
+			SystemAccess access;
+			std::vector<std::uint32_t> dependents;
+			std::uint32_t dependencyCount = 0;
+			std::atomic<std::uint32_t> waiting{ 0 };    // Dependencies not finished this frame
+			bool ranAhead = false;                      // Updated by a frame another system's Dispatch started
+		};
+
+		static bool Conflicts(const SystemAccess& first, const SystemAccess& second);
+		static void BuildGraph();
+		static void MakeReady(std::uint32_t node);
+		static void RunNode(void* context, std::uint32_t node);
+
+		static std::vector<std::unique_ptr<Node>> nodes;
+		static bool graphDirty;
+		static float frameDeltaTime;
+		static std::atomic<std::uint32_t> unfinished;
+		static std::atomic<bool> frameRunning;                 // Read by Dispatch and Defer on any thread
+		static std::vector<std::function<void()>> deferred;   // Guarded by mainThreadMutex
+
+		static std::mutex mainThreadMutex;
+		static std::vector<std::uint32_t> mainThreadReady;
+		static std::condition_variable mainThreadWake;     // Main thread system ready, or the frame finished
+
+		static std::vector<std::vector<SystemTiming>> threadTimelines;   // Indexed by thread, written only by that thread
+		static std::vector<SystemTiming> lastFrame;
+		static double lastFrameMs;
+	};
+}
+#endif // !_SYSTEM_SCHEDULER_H_
@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TagIndex.cpp
+///
+/// @brief Tag interning, per-entity tag bits and the per-tag entity lists.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "TagIndex.h"
+#include <algorithm>
+#include <iostream>
+#include "Coordinator.h"
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+	std::vector<std::string> TagIndex::names{};
+	std::unordered_map<std::string, TagId> TagIndex::ids{};
+	std::vector<std::bitset<TagIndex::MaxTags>> TagIndex::tagsOfEntity{};
+	std::vector<std::uint32_t> TagIndex::generations{};
+	std::vector<Signature> TagIndex::importedSignatures{};
+	std::vector<std::uint32_t> TagIndex::importedTagCounts{};
+	std::vector<Entity> TagIndex::trackedEntities{};
+	std::vector<std::uint32_t> TagIndex::trackedSlots{};
+	std::uint32_t TagIndex::lastGeneration{};
+	std::vector<std::vector<Entity>> TagIndex::entitiesOfTag{};
+
+	TagId TagIndex::Intern(const std::string& name)
+	{
+		auto found = ids.find(name);
+		if (found != ids.end())
+		{
+			return found->second;
+		}
+		if (names.size() >= MaxTags)
+		{
+			std::cerr << "TagIndex: more than " << MaxTags << " tags, '" << name << "' is not indexed" << std::endl;
+			return NoTag;
+		}
+
+		TagId tag = static_cast<TagId>(names.size());
+		names.push_back(name);
+		entitiesOfTag.emplace_back();
+		ids.emplace(name, tag);
+		return tag;
+	}
+
+	const std::string& TagIndex::NameOf(TagId tag)
+	{
+		static const std::string none;
+		return (tag < names.size()) ? names[tag] : none;
+	}
+
+	void TagIndex::Track(Entity entity)
+	{
+		if (entity >= generations.size())
+		{
+			generations.resize(entity + 1, 0);
+			importedSignatures.resize(entity + 1);
+			importedTagCounts.resize(entity + 1, 0);
+			trackedSlots.resize(entity + 1, 0);
+			tagsOfEntity.resize(entity + 1);
+		}
+		generations[entity] = ++lastGeneration;
+		importedSignatures[entity] = ecsInterface.GetEntitySignature(entity);
+		trackedSlots[entity] = static_cast<std::uint32_t>(trackedEntities.size());
+		trackedEntities.push_back(entity);
+
+		auto&& coordinatorTags = ecsInterface.GetTagsOfEntity(entity);
+		importedTagCounts[entity] = static_cast<std::uint32_t>(coordinatorTags.size());
+		for (const std::string& name : coordinatorTags)
+		{
+			TagId tag = Intern(name);
+			if (tag != NoTag && !tagsOfEntity[entity].test(tag))
+			{
+				tagsOfEntity[entity].set(tag);
+				entitiesOfTag[tag].push_back(entity);
+			}
+		}
+	}
+
+	void TagIndex::Add(Entity entity, TagId tag)
+	{
+		if (tag >= names.size() || Has(entity, tag))
+		{
+			return;
+		}
+		tagsOfEntity[entity].set(tag);
+		entitiesOfTag[tag].push_back(entity);
+		++importedTagCounts[entity];
+		ecsInterface.AddTag(entity, names[tag]);
+	}
+
+	const std::vector<Entity>& TagIndex::EntitiesWith(TagId tag)
+	{
+		static const std::vector<Entity> none;
+		return (tag < entitiesOfTag.size()) ? entitiesOfTag[tag] : none;
+	}
+
+	void TagIndex::RemoveEntity(Entity entity)
+	{
+		if (entity >= generations.size() || !generations[entity])
+		{
+			return;
+		}
+
+		std::bitset<MaxTags>& tags = tagsOfEntity[entity];
+		for (std::size_t tag = 0; tag < names.size() && tags.any(); ++tag)
+		{
+			if (!tags.test(tag))
+			{
+				continue;
+			}
+			std::vector<Entity>& entities = entitiesOfTag[tag];
+			entities.erase(std::find(entities.begin(), entities.end(), entity));
+			tags.reset(tag);
+		}
+		generations[entity] = 0;
+
+		// Swap-remove from the entities Sync visits
+		Entity moved = trackedEntities.back();
+		trackedEntities[trackedSlots[entity]] = moved;
+		trackedSlots[moved] = trackedSlots[entity];
+		trackedEntities.pop_back();
+	}
+
+	bool TagIndex::MatchesCoordinator(Entity entity)
+	{
+		if (ecsInterface.GetEntitySignature(entity) != importedSignatures[entity])
+		{
+			return false;
+		}
+
+		auto&& coordinatorTags = ecsInterface.GetTagsOfEntity(entity);
+		if (coordinatorTags.size() != importedTagCounts[entity])
+		{
+			return false;
+		}
+		// Same count, so the sets only differ if one of the Coordinator's names is missing here. Track interns
+		// every name it imports, so a name without an id is new unless the table was already full
+		for (const std::string& name : coordinatorTags)
+		{
+			auto found = ids.find(name);
+			bool missing = (found == ids.end()) ? names.size() < MaxTags : !tagsOfEntity[entity].test(found->second);
+			if (missing)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void TagIndex::Sync()
+	{
+		for (std::size_t slot = 0; slot < trackedEntities.size();)
+		{
+			Entity entity = trackedEntities[slot];
+			if (MatchesCoordinator(entity))
+			{
+				++slot;
+				continue;
+			}
+			// Destroyed, reused, changed or tagged behind the index's back: the last tracked entity moves into this slot
+			RemoveEntity(entity);
+		}
+	}
+
+	void TagIndex::Clear()
+	{
+		std::fill(generations.begin(), generations.end(), 0u);
+		trackedEntities.clear();
+		for (std::bitset<MaxTags>& tags : tagsOfEntity)
+		{
+			tags.reset();
+		}
+		for (std::vector<Entity>& entities : entitiesOfTag)
+		{
+			entities.clear();
+		}
+	}
+}
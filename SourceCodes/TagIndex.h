@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TagIndex.h
+///
+/// @brief Interned entity tags for the hot paths. Each tag name maps to a
+///        small integer id once; an entity's tags are a bitset, so a check
+///        is a bit test, and every tag keeps the dense list of its entities,
+///        so "which entities have tag X" costs the number of matches.
+///
+///        The Coordinator still owns the tags (serialization, the editor's
+///        tag list): Add writes through to it, and an entity's existing tags
+///        are imported the first time the index sees it. Entities are
+///        destroyed and their ids reused by gameplay code the index never
+///        hears from, and gameplay may tag through the Coordinator
+///        directly, so Sync, once per frame, drops every entity whose
+///        signature or Coordinator tags differ from its import; it is
+///        imported again, with a new generation, when next asked. RemoveEntity does the same
+///        right away, and Clear drops everything on a scene change;
+///        interned ids stay valid across all of them.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _TAG_INDEX_H_
+#define _TAG_INDEX_H_
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ComponentList.h"
+
+namespace Framework {
+
+	using TagId = std::uint16_t;
+
+	class TagIndex
+	{
+	public:
+		static constexpr std::size_t MaxTags = 256;
+		static constexpr TagId NoTag = static_cast<TagId>(MaxTags);
+
+		// The id of a tag name, NoTag once MaxTags names are interned
+		static TagId Intern(const std::string& name);
+
+		static const std::string& NameOf(TagId tag);
+
+		static bool Has(Entity entity, TagId tag)
+		{
+			if (entity >= generations.size() || !generations[entity])
+			{
+				Track(entity);
+			}
+			return tag < MaxTags && tagsOfEntity[entity].test(tag);
+		}
+
+		// Changes every time the entity's tags are imported, for callers caching something derived from them
+		static std::uint32_t GetGeneration(Entity entity)
+		{
+			if (entity >= generations.size() || !generations[entity])
+			{
+				Track(entity);
+			}
+			return generations[entity];
+		}
+
+		// Tags the entity here and in the Coordinator
+		static void Add(Entity entity, TagId tag);
+
+		// Entities with the tag, in the order they got it
+		static const std::vector<Entity>& EntitiesWith(TagId tag);
+
+		// Forgets a destroyed entity; its id is imported afresh when it is reused
+		static void RemoveEntity(Entity entity);
+
+		/**
+		 * @brief Forgets the entities destroyed, reused, given other components or tagged in the Coordinator
+		 *        since they were imported. Call once per frame before the tags are read; changes made between
+		 *        two calls are seen from the next one.
+		 */
+		static void Sync();
+
+		// Forgets every entity, e.g. when the scene is cleared
+		static void Clear();
+
+	private:
+		// Imports the entity's tags from the Coordinator
+		static void Track(Entity entity);
+
+		// Whether the entity's signature and Coordinator tags are still those it was imported with
+		static bool MatchesCoordinator(Entity entity);
+
+		static std::vector<std::string> names;
+		static std::unordered_map<std::string, TagId> ids;
+		static std::vector<std::bitset<MaxTags>> tagsOfEntity;     // Indexed by entity
+		static std::vector<std::uint32_t> generations;              // Indexed by entity, 0 until its tags are imported
+		static std::vector<Signature> importedSignatures;          // Indexed by entity, signature when imported
+		static std::vector<std::uint32_t> importedTagCounts;        // Indexed by entity, Coordinator tag count since import
+		static std::vector<Entity> trackedEntities;                 // Imported entities, visited by Sync
+		static std::vector<std::uint32_t> trackedSlots;             // Indexed by entity, position in trackedEntities
+		static std::uint32_t lastGeneration;
+		static std::vector<std::vector<Entity>> entitiesOfTag;      // Indexed by tag
+	};
+}
+#endif // !_TAG_INDEX_H_
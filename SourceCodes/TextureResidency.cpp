@@ -0,0 +1,383 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TextureResidency.cpp
+///
+/// @brief Texture handle table with LRU eviction against a VRAM budget.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "TextureResidency.h"
+#include <algorithm>
+#include <unordered_set>
+#include "AnimationStateMachine.h"
+#include "AssetManager.h"
+#include "Coordinator.h"
+#include "Graphics.h"
+#include "GraphicsStats.h"
+#include "GraphicsTextures.h"
+#include "imgui.h"
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+	std::size_t TextureResidency::budgetBytes = 256u * 1024u * 1024u;
+	std::vector<ResidentTexture> TextureResidency::slots{};
+	std::unordered_map<std::string, std::uint32_t> TextureResidency::slotLookup{};
+	std::vector<std::uint32_t> TextureResidency::freeSlots{};
+	std::size_t TextureResidency::residentBytes{};
+	std::size_t TextureResidency::residentCount{};
+	std::uint64_t TextureResidency::frame = 1;
+	std::uint64_t TextureResidency::evictRetryFrame{};
+	std::size_t TextureResidency::evictBlockedBytes{};
+	std::size_t TextureResidency::evictBlockedEntities{};
+
+	// Texture names the given entities draw with, or can switch to through their animation state machine
+	static std::unordered_set<std::string> CollectSceneTextures(const std::vector<Entity>& sceneEntities)
+	{
+		std::unordered_set<std::string> names;
+		for (Entity entity : sceneEntities)
+		{
+			if (!ecsInterface.IsEntityValid(entity))
+			{
+				continue;
+			}
+			if (ecsInterface.HasComponent<RenderComponent>(entity))
+			{
+				names.insert(ecsInterface.GetComponent<RenderComponent>(entity).textureID);
+			}
+			if (ecsInterface.HasComponent<UIBarComponent>(entity))
+			{
+				const UIBarComponent& bar = ecsInterface.GetComponent<UIBarComponent>(entity);
+				names.insert(bar.backingTextureID);
+				names.insert(bar.fillTextureID);
+			}
+		}
+
+		// Hit and death sheets are not shown yet but were preloaded with the scene, the first hit must not reload them
+		std::vector<std::string> shown(names.begin(), names.end());
+		for (const std::string& sheet : shown)
+		{
+			AnimationStateMachines::CollectMachineSheets(sheet, names);
+		}
+		return names;
+	}
+
+	GLuint TextureBinding::Get(const std::string& currentName)
+	{
+		// A removed and re-imported asset keeps its name but gets a new generation
+		if (currentName != name || !TextureResidency::IsCurrent(handle))
+		{
+			name = currentName;
+			handle = TextureResidency::Resolve(name);
+		}
+		return TextureResidency::Get(handle);
+	}
+
+	bool TextureBinding::IsPremultiplied() const
+	{
+		return TextureResidency::IsPremultiplied(handle);
+	}
+
+	TextureHandle TextureResidency::Resolve(const std::string& name)
+	{
+		auto it = slotLookup.find(name);
+		if (it != slotLookup.end())
+		{
+			return { it->second, slots[it->second].generation };
+		}
+
+		std::uint32_t index;
+		if (!freeSlots.empty())
+		{
+			index = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else
+		{
+			index = static_cast<std::uint32_t>(slots.size());
+			slots.emplace_back();
+		}
+
+		ResidentTexture& slot = slots[index];
+		slot.name = name;
+		slot.occupied = true;
+		slotLookup.emplace(name, index);
+		return { index, slot.generation };
+	}
+
+	GLuint TextureResidency::Get(TextureHandle handle)
+	{
+		if (!IsCurrent(handle))
+		{
+			return 0;
+		}
+		ResidentTexture& slot = slots[handle.index];
+
+		if (!slot.loaded)
+		{
+			MarkLoaded(slot, GraphicsTextures::Load(slot.name));
+		}
+		slot.lastUsedFrame = frame;
+		return slot.handle;
+	}
+
+	void TextureResidency::MarkLoaded(ResidentTexture& slot, const LoadedTexture& texture)
+	{
+		slot.handle = texture.texture;
+		slot.bytes = texture.bytes;
+		slot.premultiplied = texture.premultiplied;
+		slot.loaded = true;
+		residentBytes += slot.bytes;
+		++residentCount;
+
+		// Kept in sync for code that reads the name -> texture map directly
+		Graphics::textures[slot.name] = slot.handle;
+
+		// Sprites drawn before the upload (preloader, browser placeholder) show it in the editor viewport
+		Graphics::MarkSceneDirty();
+	}
+
+	bool TextureResidency::Adopt(const std::string& name, const LoadedTexture& texture)
+	{
+		// Already loaded here or by the AssetManager, the copy is not needed
+		ResidentTexture& slot = slots[Resolve(name).index];
+		auto& textureAssets = GlobalAssetManager.UE_GetAllTextureAssets();
+		auto asset = textureAssets.find(name);
+		if (slot.loaded || (asset != textureAssets.end() && asset->second.textureID != 0))
+		{
+			GraphicsStats::UntrackTexture(texture.texture);
+			glDeleteTextures(1, &texture.texture);
+			return false;
+		}
+
+		MarkLoaded(slot, texture);
+		slot.lastUsedFrame = frame;
+
+		// The AssetManager returns this texture from now on instead of decoding the image itself
+		if (asset != textureAssets.end())
+		{
+			asset->second.textureID = texture.texture;
+		}
+		return true;
+	}
+
+	bool TextureResidency::IsResident(const std::string& name)
+	{
+		auto it = slotLookup.find(name);
+		return it != slotLookup.end() && slots[it->second].loaded && slots[it->second].handle != 0;
+	}
+
+	GLuint TextureResidency::Peek(const std::string& name)
+	{
+		auto it = slotLookup.find(name);
+		return (it != slotLookup.end() && slots[it->second].loaded) ? slots[it->second].handle : 0;
+	}
+
+	bool TextureResidency::IsPremultiplied(TextureHandle handle)
+	{
+		if (handle.index >= slots.size())
+		{
+			return false;
+		}
+		const ResidentTexture& slot = slots[handle.index];
+		return slot.occupied && slot.generation == handle.generation && slot.loaded && slot.premultiplied;
+	}
+
+	bool TextureResidency::Rename(const std::string& oldName, const std::string& newName)
+	{
+		auto it = slotLookup.find(oldName);
+		if (it == slotLookup.end() || slotLookup.count(newName) != 0)
+		{
+			return false;
+		}
+
+		std::uint32_t index = it->second;
+		slotLookup.erase(it);
+		slotLookup.emplace(newName, index);
+		slots[index].name = newName;
+
+		auto texture = Graphics::textures.find(oldName);
+		if (texture != Graphics::textures.end())
+		{
+			GLuint handle = texture->second;
+			Graphics::textures.erase(texture);
+			Graphics::textures[newName] = handle;
+		}
+		return true;
+	}
+
+	void TextureResidency::Remove(const std::string& name)
+	{
+		auto it = slotLookup.find(name);
+		if (it == slotLookup.end())
+		{
+			return;
+		}
+
+		ResidentTexture& slot = slots[it->second];
+		if (slot.loaded)
+		{
+			Release(slot);
+		}
+		std::uint32_t generation = slot.generation + 1;
+		slot = ResidentTexture{};
+		slot.generation = generation;
+		freeSlots.push_back(it->second);
+		slotLookup.erase(it);
+	}
+
+	void TextureResidency::Pin(const std::string& name)
+	{
+		auto it = slotLookup.find(name);
+		if (it != slotLookup.end())
+		{
+			slots[it->second].pinned = true;
+		}
+	}
+
+	void TextureResidency::EndFrame(const std::vector<Entity>& sceneEntities)
+	{
+		// Over budget with nothing evictable last time: wait for a load, a scene change or textures to age
+		bool blocked = frame < evictRetryFrame && residentBytes == evictBlockedBytes && sceneEntities.size() == evictBlockedEntities;
+		if (residentBytes > budgetBytes && !blocked)
+		{
+			Evict(sceneEntities, budgetBytes);
+			if (residentBytes > budgetBytes)
+			{
+				evictRetryFrame = frame + EvictRetryFrames;
+				evictBlockedBytes = residentBytes;
+				evictBlockedEntities = sceneEntities.size();
+			}
+		}
+		++frame;
+	}
+
+	std::size_t TextureResidency::EvictUnused(const std::vector<Entity>& sceneEntities)
+	{
+		return Evict(sceneEntities, 0);
+	}
+
+	std::size_t TextureResidency::Evict(const std::vector<Entity>& sceneEntities, std::size_t targetBytes)
+	{
+		std::unordered_set<std::string> sceneTextures = CollectSceneTextures(sceneEntities);
+
+		std::vector<std::pair<std::uint64_t, std::uint32_t>> candidates;
+		for (std::uint32_t index = 0; index < slots.size(); ++index)
+		{
+			const ResidentTexture& slot = slots[index];
+			if (slot.loaded && !slot.pinned && slot.lastUsedFrame != frame && sceneTextures.count(slot.name) == 0)
+			{
+				candidates.emplace_back(slot.lastUsedFrame, index);
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		std::size_t freed = 0;
+		for (const auto& candidate : candidates)
+		{
+			if (residentBytes <= targetBytes)
+			{
+				break;
+			}
+			freed += slots[candidate.second].bytes;
+			Release(slots[candidate.second]);
+		}
+		return freed;
+	}
+
+	void TextureResidency::Release(ResidentTexture& texture)
+	{
+		GraphicsStats::UntrackTexture(texture.handle);
+		glDeleteTextures(1, &texture.handle);
+		residentBytes -= texture.bytes;
+		--residentCount;
+		Graphics::textures.erase(texture.name);
+
+		// The AssetManager caches the GL name per asset, clearing it makes UE_LoadTextureToOpenGL load the file again
+		auto& textureAssets = GlobalAssetManager.UE_GetAllTextureAssets();
+		auto asset = textureAssets.find(texture.name);
+		if (asset != textureAssets.end())
+		{
+			asset->second.textureID = 0;
+		}
+
+		// The slot and its handles survive, the next Get reloads
+		texture.handle = 0;
+		texture.bytes = 0;
+		texture.loaded = false;
+		texture.premultiplied = false;
+	}
+
+	void TextureResidency::Clear()
+	{
+		slots.clear();
+		slotLookup.clear();
+		freeSlots.clear();
+		residentBytes = 0;
+		residentCount = 0;
+	}
+
+	void TextureResidency::ShowImGui(const std::vector<Entity>& sceneEntities)
+	{
+		if (ImGui::CollapsingHeader("Texture Residency", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			int budgetMB = static_cast<int>(budgetBytes / (1024 * 1024));
+			if (ImGui::SliderInt("Budget (MB)", &budgetMB, 16, 2048))
+			{
+				budgetBytes = static_cast<std::size_t>(budgetMB) * 1024 * 1024;
+			}
+			ImGui::Text("Resident: %zu of %zu textures, %.2f / %d MB", residentCount, slotLookup.size(), residentBytes / (1024.0 * 1024.0), budgetMB);
+			if (ImGui::Button("Evict Unused Now"))
+			{
+				EvictUnused(sceneEntities);
+			}
+
+			if (ImGui::BeginTable("ResidentTextures", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 200.0f)))
+			{
+				ImGui::TableSetupColumn("Texture");
+				ImGui::TableSetupColumn("Size (KB)");
+				ImGui::TableSetupColumn("Last Used");
+				ImGui::TableHeadersRow();
+
+				// Most recently used first
+				std::vector<const ResidentTexture*> rows;
+				rows.reserve(residentCount);
+				for (const ResidentTexture& slot : slots)
+				{
+					if (slot.loaded)
+					{
+						rows.push_back(&slot);
+					}
+				}
+				std::sort(rows.begin(), rows.end(), [](const ResidentTexture* a, const ResidentTexture* b)
+				{
+					return a->lastUsedFrame > b->lastUsedFrame;
+				});
+
+				for (const ResidentTexture* texture : rows)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0);
+					ImGui::Text("%s%s", texture->name.c_str(), texture->pinned ? " (pinned)" : "");
+					ImGui::TableSetColumnIndex(1);
+					ImGui::Text("%.1f", texture->bytes / 1024.0);
+					ImGui::TableSetColumnIndex(2);
+					if (texture->lastUsedFrame == frame)
+					{
+						ImGui::TextUnformatted("this frame");
+					}
+					else
+					{
+						ImGui::Text("%llu frames ago", static_cast<unsigned long long>(frame - texture->lastUsedFrame));
+					}
+				}
+				ImGui::EndTable();
+			}
+		}
+	}
+}
@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TextureResidency.h
+///
+/// @brief Handle table and residency manager for the textures the renderer
+///        loads. Texture names resolve once to a small integer handle with a
+///        generation counter. Handles index a dense slot table and stay valid
+///        across eviction and asset renames. When the resident total goes over
+///        a VRAM budget, the least recently used textures the current scene
+///        does not reference are evicted and reloaded through the AssetManager
+///        on their next use.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _TEXTURE_RESIDENCY_H_
+#define _TEXTURE_RESIDENCY_H_
+
+#include <glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ComponentList.h"
+#include "GraphicsTextures.h"
+
+namespace Framework {
+
+	struct TextureHandle
+	{
+		static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+		std::uint32_t index = InvalidIndex;
+		std::uint32_t generation = 0;   // Must match the slot, a removed asset bumps it
+
+		bool IsValid() const { return index != InvalidIndex; }
+	};
+
+	struct ResidentTexture
+	{
+		std::string name;
+		GLuint handle = 0;              // 0 while evicted or if the asset failed to load
+		std::size_t bytes = 0;
+		std::uint64_t lastUsedFrame = 0;
+		std::uint32_t generation = 0;
+		bool occupied = false;          // Slot holds a texture name
+		bool loaded = false;            // Load attempted since the last eviction
+		bool pinned = false;            // Never evicted, e.g. default mesh textures
+		bool premultiplied = false;     // Loaded from a cooked file with premultiplied alpha
+	};
+
+	// Handle cached next to a texture name stored in a component, re-resolved when the name changes or the handle goes stale
+	struct TextureBinding
+	{
+		std::string name;
+		TextureHandle handle;
+
+		/**
+		 * @brief Returns the texture for the component's current name, marking it as used this frame.
+		 */
+		GLuint Get(const std::string& currentName);
+
+		// Whether the texture returned by the last Get has premultiplied alpha
+		bool IsPremultiplied() const;
+	};
+
+	class TextureResidency
+	{
+	public:
+		/**
+		 * @brief Resolves an asset name to its handle, adding a slot if the name is new.
+		 *        Does not load the texture.
+		 */
+		static TextureHandle Resolve(const std::string& name);
+
+		/**
+		 * @brief Returns the texture of a handle, loading it on first use or after eviction,
+		 *        and marks it as used this frame.
+		 *
+		 * @return the GL texture, or 0 if the handle is stale or the asset could not be loaded.
+		 */
+		static GLuint Get(TextureHandle handle);
+
+		// Whether the handle still names its slot, false once the asset was removed (even if re-added under the same name)
+		static bool IsCurrent(TextureHandle handle)
+		{
+			return handle.index < slots.size() && slots[handle.index].occupied && slots[handle.index].generation == handle.generation;
+		}
+
+		// Resolve and Get in one call, for code that only has the name
+		static GLuint Acquire(const std::string& name) { return Get(Resolve(name)); }
+
+		/**
+		 * @brief Whether the loaded texture of a handle stores premultiplied colour, so the
+		 *        draw should blend with GL_ONE instead of GL_SRC_ALPHA.
+		 */
+		static bool IsPremultiplied(TextureHandle handle);
+
+		/**
+		 * @brief Hands a texture created outside Get (e.g. by ScenePreloader) to its slot, as if Get had loaded it.
+		 *
+		 * @return false, deleting the texture, if the slot already holds one.
+		 */
+		static bool Adopt(const std::string& name, const LoadedTexture& texture);
+
+		// Whether the named texture is currently in VRAM
+		static bool IsResident(const std::string& name);
+
+		// The named texture if it is in VRAM, else 0; neither loads it nor marks it as used, e.g. for editor previews
+		static GLuint Peek(const std::string& name);
+
+		/**
+		 * @brief Moves a slot to a new asset name. Existing handles keep pointing at it.
+		 *
+		 * @return false if oldName is unknown or newName is already in use.
+		 */
+		static bool Rename(const std::string& oldName, const std::string& newName);
+
+		/**
+		 * @brief Frees the texture and its slot for a deleted asset. Existing handles become stale.
+		 *        Call before AssetManager::UE_DeleteTexture.
+		 */
+		static void Remove(const std::string& name);
+
+		/**
+		 * @brief Excludes a texture from eviction.
+		 */
+		static void Pin(const std::string& name);
+
+		/**
+		 * @brief Advances the frame counter and evicts textures while over budget.
+		 *        Called once at the end of Graphics::Update.
+		 *
+		 * @param sceneEntities renderable entities of the current scene, their textures are kept.
+		 */
+		static void EndFrame(const std::vector<Entity>& sceneEntities);
+
+		/**
+		 * @brief Evicts every texture that is not pinned, used this frame or referenced by the scene,
+		 *        regardless of the budget. Useful after a scene change.
+		 *
+		 * @return the number of bytes freed.
+		 */
+		static std::size_t EvictUnused(const std::vector<Entity>& sceneEntities);
+
+		// Drops the bookkeeping at shutdown, the AssetManager releases the textures themselves
+		static void Clear();
+
+		static std::size_t GetResidentBytes() { return residentBytes; }
+		static std::size_t GetResidentCount() { return residentCount; }
+
+		/**
+		 * @brief Draws the budget and resident texture list inside the currently open ImGui window (DebugSystem panel).
+		 */
+		static void ShowImGui(const std::vector<Entity>& sceneEntities);
+
+		// VRAM the resident textures may use before eviction starts
+		static std::size_t budgetBytes;
+
+	private:
+		// Evicts least recently used candidates until residentBytes <= targetBytes
+		static std::size_t Evict(const std::vector<Entity>& sceneEntities, std::size_t targetBytes);
+		static void Release(ResidentTexture& texture);
+		static void MarkLoaded(ResidentTexture& slot, const LoadedTexture& texture);
+
+		static std::vector<ResidentTexture> slots;
+		static std::unordered_map<std::string, std::uint32_t> slotLookup;
+		static std::vector<std::uint32_t> freeSlots;
+		static std::size_t residentBytes;
+		static std::size_t residentCount;
+		static std::uint64_t frame;
+
+		// An eviction that left the total over budget is not retried for this many frames, unless a texture was
+		// loaded or released or the scene's entity count changed; the scene alone can be over budget
+		static constexpr std::uint64_t EvictRetryFrames = 30;
+		static std::uint64_t evictRetryFrame;
+		static std::size_t evictBlockedBytes;
+		static std::size_t evictBlockedEntities;
+	};
+}
+#endif // !_TEXTURE_RESIDENCY_H_
@@ -25,6 +25,12 @@
 #include <vector>
 #include "SceneManager.h"
 #include "GraphicsWindows.h"
+#include "EntityView.h"
+#include "SceneEvents.h"
+#include "ScenePreloader.h"
+#include "SequenceScheduler.h"
+#include "SystemScheduler.h"
+#include "TweenEngine.h"
 #include "cmath"
 
 
@@ -38,9 +44,29 @@ float Lerp(float a, float b, float t) {
     return a + t * (b - a);
 }
 
+// Every transition below switches scenes through here, so the old scene's tweens, timers and sequences go with it.
+// Timelines run beside other systems, the load waits until the frame's systems are done
+void GoToScene(const std::string& scene) {
+    Framework::SystemScheduler::Defer([scene]() {
+        Framework::ScenePreloader::Finish(scene);
+        Framework::GlobalSceneManager.TransitionToScene(scene);
+        Framework::SceneEvents::OnSceneLoaded(scene);
+    });
+}
+
+// Creates entities, so like a scene load it waits for the end of the frame
+void SpawnPrefab(const std::string& prefab) {
+    Framework::SystemScheduler::Defer([prefab]() { GlobalAssetManager.UE_LoadPrefab(prefab); });
+}
+
+// Other systems check the pause state as they start, it changes between frames
+void SetGamePaused(bool paused) {
+    Framework::SystemScheduler::Defer([paused]() { Framework::engineState.SetPaused(paused); });
+}
+
 void SlideInTransition(Framework::Entity entity, float timer) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     // Calculate progress as a fraction of the transition duration
     float progress = timer / timeline.TransitionDuration;
@@ -48,6 +74,9 @@ void SlideInTransition(Framework::Entity entity, float timer) {
     // Ensure progress is clamped between 0.0 and 1.0
     progress = std::min(progress, 1.0f);
 
+    // Decode the next scene's textures on worker threads while the slide plays
+    Framework::ScenePreloader::Begin(Framework::GlobalSceneManager.Variable_Scene);
+
     // Lerp based on progress from starting position to the target position
     float startPosition = timeline.startPosition; // Example: off-screen starting position // 2400.0f
     float targetPosition = timeline.endPosition; // Example: target position in the center // 800
@@ -59,16 +88,16 @@ void SlideInTransition(Framework::Entity entity, float timer) {
         timeline.InternalTimer = 0.0f; // Reset the timer for TransitionOut
 
         //Time enemy to spawn after transition.
-       Framework::engineState.SetPaused(false);
+       SetGamePaused(false);
         // Logic to start the game
-       Framework::GlobalSceneManager.TransitionToScene(Framework::GlobalSceneManager.Variable_Scene);
+       GoToScene(Framework::GlobalSceneManager.Variable_Scene);
    
     }
 }
 
 void SlideOut(Framework::Entity entity, float timer) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     // Calculate progress as a fraction of the transition duration
     float progress = timer / timeline.TransitionDuration;
@@ -92,8 +121,8 @@ void SlideOut(Framework::Entity entity, float timer) {
 }
 
 void SlideOutWarning(Framework::Entity entity, float timer) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     // Calculate progress as a fraction of the transition duration
     float progress = timer / timeline.TransitionDuration;
@@ -108,7 +137,7 @@ void SlideOutWarning(Framework::Entity entity, float timer) {
 
     if (progress >= 1.0f) {
         // Transition complete, switch to TransitionOut
-        GlobalAssetManager.UE_LoadPrefab("BossBar.json");
+        SpawnPrefab("BossBar.json");
         timeline.IsTransitioningIn = false;
         progress = 0.0f;
         // Framework::engineState.SetPaused(true);
@@ -117,8 +146,8 @@ void SlideOutWarning(Framework::Entity entity, float timer) {
 
 void SlideInElastic(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     // Calculate progress as a fraction of the transition duration
     float progress = timer / timeline.TransitionDuration;
@@ -148,8 +177,8 @@ void SlideInElastic(Framework::Entity entity, float timer)
 
 void SlideUp(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float progress = timer / timeline.TransitionDuration;
     progress = std::min(progress, 1.0f);
@@ -162,14 +191,14 @@ void SlideUp(Framework::Entity entity, float timer)
     if (progress >= 1.0f) 
     {
         timeline.IsTransitioningIn = false;
-        Framework::engineState.SetPaused(false);
+        SetGamePaused(false);
     }
 }
 
 void Credits(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float progress = timer / timeline.TransitionDuration;
     progress = std::min(progress, 1.0f);
@@ -191,8 +220,8 @@ void Credits(Framework::Entity entity, float timer)
 
 void SlideDiag(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float progress = timer / timeline.TransitionDuration;
     progress = std::min(progress, 1.0f);
@@ -206,15 +235,15 @@ void SlideDiag(Framework::Entity entity, float timer)
     if (progress >= 1.0f)
     {
         timeline.IsTransitioningIn = false;
-        Framework::engineState.SetPaused(false);
+        SetGamePaused(false);
     }
 }
 
 
 void SlideInBounce(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     // Calculate progress as a fraction of the transition duration
     float progress = timer / timeline.TransitionDuration;
@@ -240,7 +269,7 @@ void SlideInBounce(Framework::Entity entity, float timer)
         {
             timeline.IsTransitioningIn = false;
             timeline.InternalTimer = 0.0f; // Reset timer for next transition
-            Framework::engineState.SetPaused(false);
+            SetGamePaused(false);
         }
     }
 }
@@ -248,8 +277,8 @@ void SlideInBounce(Framework::Entity entity, float timer)
 
 void SlideInWobbly(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float progress = timer / timeline.TransitionDuration;
     progress = std::min(progress, 1.0f);
@@ -265,14 +294,14 @@ void SlideInWobbly(Framework::Entity entity, float timer)
     if (progress >= 1.0f)
     {
         timeline.IsTransitioningIn = false;
-        Framework::engineState.SetPaused(false);
+        SetGamePaused(false);
     }
 }
 
 void SlideInCircular(Framework::Entity entity, float timer)
 {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float progress = timer / timeline.TransitionDuration;
     progress = std::min(progress, 1.0f);
@@ -287,14 +316,14 @@ void SlideInCircular(Framework::Entity entity, float timer)
     if (progress >= 1.0f)
     {
         timeline.IsTransitioningIn = false;
-        Framework::engineState.SetPaused(false);
+        SetGamePaused(false);
     }
 }
 
 void BlinkEffect(Framework::Entity entity, float timer)
 {
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float blinkSpeed = 0.5f; // Adjust for faster/slower blinking
 
@@ -307,7 +336,7 @@ void BlinkEffect(Framework::Entity entity, float timer)
 
         if (timeline.InternalTimer >= timeline.TransitionDuration)
         {
-            GlobalAssetManager.UE_LoadPrefab("BossBar.json");
+            SpawnPrefab("BossBar.json");
             timeline.IsTransitioningIn = false; // Stop blinking after duration
             render.alpha = 0.f; // Ensure it stays fully visible at the end
         }
@@ -316,8 +345,8 @@ void BlinkEffect(Framework::Entity entity, float timer)
 
 void BlinkEffectWithoutBossSpawnPrefabs(Framework::Entity entity, float timer)
 {
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     float blinkSpeed = 0.5f; // Adjust for faster/slower blinking
 
@@ -341,7 +370,7 @@ void BlinkEffectWithoutBossSpawnPrefabs(Framework::Entity entity, float timer)
 to below as we're sharing this cpp and will have a lot of segments.
 
 void FadeInEvent(Framework::Entity entity, float progress) {
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
 
     // Reduce alpha value to fade out
     render.alpha = 0.0f + progress;
@@ -349,8 +378,8 @@ void FadeInEvent(Framework::Entity entity, float progress) {
 
 
 void FadeInEvent(Framework::Entity entity, float progress) {
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
 
     // Ensure alpha is within valid range (0.0 to 1.0)
     render.alpha = std::clamp(progress, 0.0f, 1.0f);
@@ -368,8 +397,8 @@ void FadeInEvent(Framework::Entity entity, float progress) {
 
 
 void FadeOutEvent(Framework::Entity entity, float progress) {
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
     (void)timeline;
     // Ensure alpha smoothly transitions from 1 to 0 over time
     render.alpha = std::clamp(1.0f - progress, 0.0f, 1.0f);
@@ -381,7 +410,7 @@ void FadeOutEvent(Framework::Entity entity, float progress) {
 }
 
 void FadeOutThenTransitMenu(Framework::Entity entity, float progress) {
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
 
     // Reduce alpha value to fade out
     //render.alpha = 1.0f - progress;
@@ -389,8 +418,10 @@ void FadeOutThenTransitMenu(Framework::Entity entity, float progress) {
     // Ensure alpha smoothly transitions from 1 to 0 over time
     render.alpha = std::clamp(1.0f - progress, 0.0f, 1.0f);
 
+    Framework::ScenePreloader::Begin("Assets/Scene/MenuScene.json");
+
     if (progress >= 1.0f) {
-        Framework::GlobalSceneManager.TransitionToScene("Assets/Scene/MenuScene.json");
+        GoToScene("Assets/Scene/MenuScene.json");
     }
 }
 
@@ -398,11 +429,11 @@ void RetryFunction(Framework::Entity entity, float progress) {
     (void)entity;
     (void)progress;
 
-    Framework::GlobalSceneManager.TransitionToScene("Assets/Scene/GameLevel.json");
+    GoToScene("Assets/Scene/GameLevel.json");
 }
 
 void ScaleUpEvent(Framework::Entity entity, float progress) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
     (void)transform;
     (void)progress;
     // Scale up the entity from 0.5x to 1.0x size
@@ -416,12 +447,14 @@ void ScaleUpEvent(Framework::Entity entity, float progress) {
 void TransitionToSceneEvent(Framework::Entity entity, float progress) {
     (void)entity;
 
+    Framework::ScenePreloader::Begin("Assets/Scene/GameLevel.json");
+
     // Trigger scene transition when progress reaches 1.0
     if (progress >= 1.0f) {
         //Framework::GlobalSceneManager.TransitionToScene("Assets/Scene/GameLevel.json");
         //std::cout << "TransitionToSceneEvent triggered!" << std::endl;
         std::cout << "StartScreenAnimation complete! Transitioning to GameLevel.json." << std::endl;
-        Framework::GlobalSceneManager.TransitionToScene("Assets/Scene/GameLevel.json");
+        GoToScene("Assets/Scene/GameLevel.json");
     }
 }
 
@@ -429,10 +462,10 @@ void TransitionToSceneEvent(Framework::Entity entity, float progress) {
 
 // Text Pop Up Effect (Font Size-Based Shrinking) zoom in version
 void TextPopupFlyOut(Framework::Entity entity, float timer) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& text = ecsInterface.GetComponent<TextComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& text = Framework::CheckedGetComponent<TextComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
 
     // Progress between 0 and 1 (clamped)
     float progress = std::min(timer / timeline.TransitionDuration, 1.0f);
@@ -458,10 +491,10 @@ void TextPopupFlyOut(Framework::Entity entity, float timer) {
 
 /// Text Pop Up Effect (Font Size-Based Shrinking) zoom in version
 void TextPopup(Framework::Entity entity, float timer) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& text = ecsInterface.GetComponent<TextComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& text = Framework::CheckedGetComponent<TextComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
 
     // Progress between 0 and 1 (clamped)
     float progress = std::min(timer / timeline.TransitionDuration, 1.0f);
@@ -496,10 +529,10 @@ void TextPopup(Framework::Entity entity, float timer) {
 // ------------------- Ability functions -------------- //
 
 void SlowPrefabFunction(Framework::Entity entity, float timer) {
-    auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-    auto& text = ecsInterface.GetComponent<TextComponent>(entity);
-    auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
-    auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
+    auto& transform = Framework::CheckedGetComponent<TransformComponent>(entity);
+    auto& text = Framework::CheckedGetComponent<TextComponent>(entity);
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
+    auto& render = Framework::CheckedGetComponent<RenderComponent>(entity);
 
     (void)transform;
     (void)text;
@@ -563,6 +596,204 @@ void SlowPrefabFunction(Framework::Entity entity, float timer) {
     }
 }
 
+// ------------------- Tween presets -------------- //
+// Data versions of the behaviors above, played by TimelineSystem through the TweenEngine in place of the
+// functions registered under the same name. Positions come from the timeline's startPosition/endPosition
+// and durations from its TransitionDuration.
+
+void UnpauseGame(Framework::Entity) {
+    SetGamePaused(false);
+}
+
+void DeactivateRender(Framework::Entity entity) {
+    Framework::CheckedGetComponent<RenderComponent>(entity).isActive = false;
+}
+
+void HideAndSpawnBossBar(Framework::Entity entity) {
+    Framework::CheckedGetComponent<RenderComponent>(entity).alpha = 0.f;
+    SpawnPrefab("BossBar.json");
+}
+
+void RegisterTweenPresets() {
+    using namespace Framework;
+
+    // Shorthand for the common single-track case
+    auto track = [](TweenProperty property, TweenValue from, TweenValue to, TweenCurve ease = TweenCurve::Linear) {
+        TweenTrackSpec spec;
+        spec.property = property;
+        spec.from = from;
+        spec.to = to;
+        spec.ease = ease;
+        return spec;
+    };
+    auto withWave = [](TweenTrackSpec spec, TweenCurve wave, float amplitude) {
+        spec.wave = wave;
+        spec.amplitude = amplitude;
+        return spec;
+    };
+    TweenTrackSpec slideX = track(TweenProperty::PositionX, TweenValue::Start(), TweenValue::End());
+    TweenTrackSpec slideY = track(TweenProperty::PositionY, TweenValue::Start(), TweenValue::End());
+
+    TweenPreset slideOut;
+    slideOut.tracks = { slideX };
+    TweenEngine::RegisterPreset("SlideOut", slideOut);
+
+    TweenPreset slideInElastic;
+    slideInElastic.tracks = { withWave(slideX, TweenCurve::ElasticBump, 20.0f) };
+    TweenEngine::RegisterPreset("SlideInElastic", slideInElastic);
+
+    TweenPreset slideUp;
+    slideUp.tracks = { slideY };
+    slideUp.onComplete = UnpauseGame;
+    TweenEngine::RegisterPreset("SlideY", slideUp);
+
+    // One pass of the credits, the CreditsY sequence repeats it
+    TweenPreset creditsScroll;
+    creditsScroll.tracks = { slideY };
+    TweenEngine::RegisterPreset("CreditsScroll", creditsScroll);
+
+    TweenPreset slideDiag;
+    slideDiag.tracks = { slideX, track(TweenProperty::PositionY, TweenValue::Start(1.0f / 1.77f), TweenValue::End(1.0f / 1.77f)) };
+    slideDiag.onComplete = UnpauseGame;
+    TweenEngine::RegisterPreset("SlideDiag", slideDiag);
+
+    // Settles around the target for a second after arriving
+    TweenTrackSpec bounce = withWave(track(TweenProperty::PositionX, TweenValue::End(), TweenValue::End()), TweenCurve::BounceSettle, 15.0f);
+    bounce.delay = TweenTime::Durations(1.0f);
+    bounce.duration = TweenTime::Seconds(1.0f);
+    TweenPreset slideInBounce;
+    slideInBounce.tracks = { slideX, bounce };
+    slideInBounce.onComplete = UnpauseGame;
+    TweenEngine::RegisterPreset("SlideInBounce", slideInBounce);
+
+    TweenPreset slideInWobbly;
+    slideInWobbly.tracks = { withWave(slideX, TweenCurve::Wobble, 20.0f) };
+    slideInWobbly.onComplete = UnpauseGame;
+    TweenEngine::RegisterPreset("SlideInWobbly", slideInWobbly);
+
+    // Quarter arc of radius 500 around (800, 600)
+    TweenPreset slideInCircular;
+    slideInCircular.tracks = {
+        track(TweenProperty::PositionX, TweenValue::Constant(1300.0f), TweenValue::Constant(800.0f), TweenCurve::QuarterCosine),
+        track(TweenProperty::PositionY, TweenValue::Constant(600.0f), TweenValue::Constant(1100.0f), TweenCurve::QuarterSine)
+    };
+    slideInCircular.onComplete = UnpauseGame;
+    TweenEngine::RegisterPreset("SlideInCircular", slideInCircular);
+
+    // A 2 second blink for half the duration, what the frame-counted version ran at 60 FPS
+    TweenTrackSpec blink = withWave(track(TweenProperty::Alpha, TweenValue::Constant(0.5f), TweenValue::Constant(0.5f)), TweenCurve::SineWave, 0.5f);
+    blink.wavePeriod = 2.0f;
+    blink.duration = TweenTime::Durations(0.5f);
+    TweenPreset blinking;
+    blinking.tracks = { blink };
+    blinking.onComplete = HideAndSpawnBossBar;
+    TweenEngine::RegisterPreset("Blinking", blinking);
+
+    TweenPreset blinkingNoSpawn;
+    blinkingNoSpawn.tracks = { blink };
+    blinkingNoSpawn.onComplete = [](Entity entity) { Framework::CheckedGetComponent<RenderComponent>(entity).alpha = 0.f; };
+    TweenEngine::RegisterPreset("BlinkingNoSpawn", blinkingNoSpawn);
+
+    // Fades last a second whatever the duration, as the behaviors above did
+    TweenTrackSpec fadeIn = track(TweenProperty::Alpha, TweenValue::Constant(0.0f), TweenValue::Constant(1.0f));
+    fadeIn.duration = TweenTime::Seconds(1.0f);
+    TweenTrackSpec fadeOut = track(TweenProperty::Alpha, TweenValue::Constant(1.0f), TweenValue::Constant(0.0f));
+    fadeOut.duration = TweenTime::Seconds(1.0f);
+
+    TweenPreset fadeInPreset;
+    fadeInPreset.tracks = { fadeIn };
+    TweenEngine::RegisterPreset("FadeIn", fadeInPreset);
+
+    TweenPreset fadeOutPreset;
+    fadeOutPreset.tracks = { fadeOut };
+    fadeOutPreset.onComplete = DeactivateRender;
+    TweenEngine::RegisterPreset("FadeOut", fadeOutPreset);
+
+    TweenPreset fadeOutToMenu;
+    fadeOutToMenu.tracks = { fadeOut };
+    fadeOutToMenu.onStart = [](Entity) { ScenePreloader::Begin("Assets/Scene/MenuScene.json"); };
+    fadeOutToMenu.onComplete = [](Entity) { GoToScene("Assets/Scene/MenuScene.json"); };
+    TweenEngine::RegisterPreset("FadeOutTransitionToMenu", fadeOutToMenu);
+
+    TweenPreset retry;
+    retry.onComplete = [](Entity) { GoToScene("Assets/Scene/GameLevel.json"); };
+    TweenEngine::RegisterPreset("RetryFunctions", retry);
+
+    TweenPreset scaleUp;
+    scaleUp.length = TweenTime::Durations(1.0f);
+    TweenEngine::RegisterPreset("ScaleUp", scaleUp);
+
+    TweenPreset toGameLevel;
+    toGameLevel.length = TweenTime::Seconds(1.0f);
+    toGameLevel.onStart = [](Entity) { ScenePreloader::Begin("Assets/Scene/GameLevel.json"); };
+    toGameLevel.onComplete = [](Entity) {
+        std::cout << "StartScreenAnimation complete! Transitioning to GameLevel.json." << std::endl;
+        GoToScene("Assets/Scene/GameLevel.json");
+    };
+    TweenEngine::RegisterPreset("TransitionToScene", toGameLevel);
+
+    // Floats up 45 pixels per second of duration, slowing down as it goes
+    TweenTrackSpec floatUp = track(TweenProperty::PositionY, TweenValue::Current(), TweenValue::Current(1.0f, -45.0f), TweenCurve::EaseOutQuad);
+
+    TweenPreset textFlyOut;
+    textFlyOut.tracks = {
+        floatUp,
+        track(TweenProperty::FontSize, TweenValue::Current(), TweenValue::Current(0.75f)),
+        track(TweenProperty::Alpha, TweenValue::Constant(1.0f), TweenValue::Constant(0.0f))
+    };
+    TweenEngine::RegisterPreset("TextPopUpFlyOut", textFlyOut);
+
+    TweenPreset textPopUp;
+    textPopUp.tracks = { floatUp, track(TweenProperty::FontSize, TweenValue::Current(), TweenValue::Current(1.5f), TweenCurve::SineArch) };
+    textPopUp.onComplete = DeactivateRender;
+    TweenEngine::RegisterPreset("TextPopUp", textPopUp);
+}
+
+// ------------------- Sequences -------------- //
+// Chains of steps written as coroutines, started by TimelineSystem for a phase named after them. Component
+// references do not survive a co_await, the entity may be gone by then, so only values are kept across one.
+
+Framework::TweenParams TimelineTweenParams(Framework::Entity entity) {
+    auto& timeline = Framework::CheckedGetComponent<TimelineComponent>(entity);
+    return { timeline.TransitionDuration, timeline.startPosition, timeline.endPosition };
+}
+
+// Slides the banner across while the next scene preloads, then starts the game in it
+Framework::Sequence SlideInSequence(Framework::Entity entity) {
+    std::string scene = Framework::GlobalSceneManager.Variable_Scene;
+    Framework::ScenePreloader::Begin(scene);
+    co_await Framework::Tween(entity, "SlideOut", TimelineTweenParams(entity));
+    SetGamePaused(false);
+    GoToScene(scene);
+}
+
+// Boss warning: slides off screen, then the boss bar arrives
+Framework::Sequence SlideOutWarningSequence(Framework::Entity entity) {
+    Framework::TweenParams params = TimelineTweenParams(entity);
+    params.startPosition = 960.0f;
+    params.endPosition = -2000.0f;
+    co_await Framework::Tween(entity, "SlideOut", params);
+    SpawnPrefab("BossBar.json");
+}
+
+// Scrolls the credits from startPosition to endPosition over and over, until the scene changes
+Framework::Sequence CreditsSequence(Framework::Entity entity) {
+    Framework::TweenParams params = TimelineTweenParams(entity);
+    if (!Framework::TweenEngine::FindPreset("CreditsScroll")) {
+        co_return; // Would not wait, and loop forever
+    }
+    for (;;) {
+        co_await Framework::Tween(entity, "CreditsScroll", params);
+    }
+}
+
+// Registered under the timeline function names the scenes use, TimelineSystem runs them in place of the functions
+void RegisterSequences() {
+    Framework::SequenceScheduler::Register("SlideIn", SlideInSequence);
+    Framework::SequenceScheduler::Register("SlideOutWarning", SlideOutWarningSequence);
+    Framework::SequenceScheduler::Register("CreditsY", CreditsSequence);
+}
+
 void RegisterTimelineEvents() {
     // Register timeline events to the LogicManager // Use this naming for ECS systems to register
     GlobalLogicManager.RegisterTimelineFunction("SlideIn", SlideInTransition);
@@ -592,6 +823,10 @@ void RegisterTimelineEvents() {
     //Ability prefab functions
     GlobalLogicManager.RegisterTimelineFunction("SlowAbilityPrefab", SlowPrefabFunction);
 
+    // Take over the names above, SlowAbilityPrefab drives engine state and stays a function
+    RegisterTweenPresets();
+    RegisterSequences();
+
     std::cout << "Timeline events registered." << std::endl;
 }
 
@@ -15,66 +15,216 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "pch.h"
+#include <algorithm>
 #include <iostream>
 #include "TimelineSystem.h"
 #include "Coordinator.h"
 #include "ComponentList.h"
+#include "ComponentTypes.h"
+#include "EntityView.h"
 #include "Graphics.h"
 #include "SceneManager.h"
 #include "EngineState.h"
+#include "SequenceScheduler.h"
+#include "TagIndex.h"
+#include "TimerWheel.h"
+#include "TweenEngine.h"
 
 extern Framework::Coordinator ecsInterface;
 
 namespace Framework {
     TimelineSystem GlobalTimelineSystem;
+    std::uint32_t TimelineSystem::timelineTagEdits{};
 
     void TimelineSystem::Initialize() {
 
-        // Register TimelineComponent with the ECS
-        ecsInterface.RegisterComponent<TimelineComponent>();
+        ComponentTypes::Register<TimelineComponent>();
 
         // Define the system's signature (entities must have TimelineComponent)
-        Signature signature;
-        signature.set(ecsInterface.GetComponentType<TimelineComponent>());
-        ecsInterface.SetSystemSignature<TimelineSystem>(signature);
+        ecsInterface.SetSystemSignature<TimelineSystem>(SignatureOf<TimelineComponent>);
+        SystemScheduler::Add(this);
         std::cout << "TimelineSystem initialized." << std::endl;
     }
+    enum TimelineTimerEvent : std::uint32_t {
+        TimelineDelayIn,
+        TimelineDelayOut
+    };
+
+    // Marks the delay of the phase as over, as if it had been accumulated frame by frame
+    static void WakeTimeline(Entity entity, std::uint32_t event) {
+        if (!ecsInterface.IsEntityValid(entity) || !CheckedHasComponent<TimelineComponent>(entity)) {
+            return;
+        }
+        auto& timeline = CheckedGetComponent<TimelineComponent>(entity);
+        if (event == TimelineDelayIn && timeline.IsTransitioningIn) {
+            timeline.DelayAccumulated = std::max(timeline.DelayAccumulated, timeline.TransitionInDelay);
+        }
+        else if (event == TimelineDelayOut && !timeline.IsTransitioningIn) {
+            timeline.DelayOutAccumulated = std::max(timeline.DelayOutAccumulated, timeline.TransitionOutDelay);
+        }
+    }
+
+    bool TimelineSystem::WaitForDelay(Entity entity, float delay, float& accumulated, std::uint32_t event, float deltaTime) {
+        // This frame counts towards the delay, as it did when the delay was accumulated every frame
+        float remaining = delay - accumulated - deltaTime;
+        if (remaining <= 0.0f) {
+            // Recorded as over, so a shorter frame later cannot put a running transition back to sleep
+            accumulated = std::max(accumulated, delay);
+            return false;
+        }
+
+        if (timelineDelays.size() <= entity) {
+            timelineDelays.resize(entity + 1);
+        }
+        timelineDelays[entity] = TimerWheel::Schedule(TimerClock::Interface, remaining, entity, WakeTimeline, event);
+        return true;
+    }
+
+    void TimelineSystem::ParkDelay(Entity entity, TimelineComponent& timeline) {
+        if (entity >= timelineDelays.size() || !TimerWheel::IsPending(timelineDelays[entity])) {
+            return;
+        }
+
+        // Back into the accumulator, as if the delay had been counted frame by frame up to now
+        float remaining = TimerWheel::Remaining(timelineDelays[entity]);
+        TimerWheel::Cancel(timelineDelays[entity]);
+        if (timeline.IsTransitioningIn) {
+            timeline.DelayAccumulated = std::max(0.0f, timeline.TransitionInDelay - remaining);
+        }
+        else {
+            timeline.DelayOutAccumulated = std::max(0.0f, timeline.TransitionOutDelay - remaining);
+        }
+    }
+
+    // Same bookkeeping as the end of a phase below, called by the tween engine and sequences
+    static void FinishTimelinePhase(Entity entity, std::uint32_t) {
+        if (!ecsInterface.IsEntityValid(entity) || !CheckedHasComponent<TimelineComponent>(entity)) {
+            return;
+        }
+        auto& timeline = CheckedGetComponent<TimelineComponent>(entity);
+        if (timeline.IsTransitioningIn) {
+            timeline.IsTransitioningIn = false;
+            timeline.InternalTimer = 0.0f;
+            timeline.DelayAccumulated = 0.0f;
+        }
+        else {
+            timeline.Active = false;
+        }
+    }
+
+    bool TimelineSystem::RunSequencePhase(Entity entity, const std::string& functionName) {
+        SequenceFactory factory = SequenceScheduler::Find(functionName);
+        if (!factory) {
+            return false;
+        }
+
+        if (timelineSequences.size() <= entity) {
+            timelineSequences.resize(entity + 1);
+        }
+        timelineSequences[entity] = SequenceScheduler::Start(factory(entity), entity, FinishTimelinePhase);
+        return true;
+    }
+
+    bool TimelineSystem::RunTweenPhase(Entity entity, TimelineComponent& timeline, const std::string& functionName, float deltaTime) {
+        const TweenPreset* preset = TweenEngine::FindPreset(functionName);
+        if (!preset) {
+            return false;
+        }
+
+        if (timelineTweens.size() <= entity) {
+            timelineTweens.resize(entity + 1);
+        }
+        TweenHandle& handle = timelineTweens[entity];
+        if (!TweenEngine::IsPlaying(handle)) {
+            TweenParams params{ timeline.TransitionDuration, timeline.startPosition, timeline.endPosition };
+            handle = TweenEngine::Play(entity, *preset, params, FinishTimelinePhase);
+        }
+
+        // Kept for scripts that read it, the tween tracks its own time
+        timeline.InternalTimer += deltaTime;
+        return true;
+    }
+
     void TimelineSystem::Update(float deltaTime) {
+        if (SystemScheduler::Dispatch(this, deltaTime)) {
+            return;
+        }
+
         // Ensure the system only runs in Play mode
         if (!engineState.IsPlay()) {
+            if (wasPlaying) {
+                wasPlaying = false;
+                TweenEngine::Clear(); // Stopping play drops the running tweens, delays and sequences with the scene
+                TimerWheel::Clear();
+                SequenceScheduler::Clear();
+            }
             return; // Do not run the timeline system
         }
+        wasPlaying = true;
+
+        // Transitions and paused menus move on the Interface clock while the game is paused
+        Graphics::MarkSceneDirty();
+
+        // Entities destroyed, reused or retagged by gameplay since last frame are re-imported with their current tags
+        TagIndex::Sync();
+
+        // Fires the delays that are over this frame, before the loop picks their timelines up
+        TimerWheel::Advance(deltaTime);
 
         // Iterate over all entities with TimelineComponent
         for (auto const& entity : mEntities) {
-            auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
-            auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-            LayerComponent& layerComponent = ecsInterface.GetComponent<LayerComponent>(entity);
-            (void)transform; // Avoids unused variable warning
-
-            // Skip rendering based on layer visibility
-            if (!engineState.layerVisibility[layerComponent.layerID]) {
-                continue;  // Skip all entities in this layer
+            auto& timeline = CheckedGetComponent<TimelineComponent>(entity);
+            LayerComponent& layerComponent = CheckedGetComponent<LayerComponent>(entity);
+
+            // Ensure the tag is applied only once, also on hidden layers so ToggleActive finds it
+            if (timelineTags.size() <= entity) {
+                timelineTags.resize(entity + 1);
+            }
+            CachedTimelineTag& cached = timelineTags[entity];
+            std::uint32_t generation = TagIndex::GetGeneration(entity);
+            if (cached.generation != generation || cached.edits != timelineTagEdits) {
+                cached.tag = TagIndex::Intern(timeline.TimelineTag);
+                cached.generation = generation;
+                cached.edits = timelineTagEdits;
+                TagIndex::Add(entity, cached.tag);
             }
 
-            // Ensure the tag is applied only once
-            if (!ecsInterface.HasTag(entity, timeline.TimelineTag)) {
-                ecsInterface.AddTag(entity, timeline.TimelineTag);
+            // Hidden layers and inactive timelines hold still: the delay stops counting down, the sequence waits
+            bool visible = engineState.layerVisibility[layerComponent.layerID];
+            if (!visible || !timeline.Active) {
+                ParkDelay(entity, timeline);
+                if (entity < timelineSequences.size()) {
+                    SequenceScheduler::SetPaused(timelineSequences[entity], true);
+                }
+                if (!timeline.Active && entity < timelineTweens.size()) {
+                    TweenEngine::Stop(timelineTweens[entity]);
+                }
+                continue;
             }
 
-            // Skip inactive timelines
-            if (!timeline.Active) {
+            // Dormant until its transition delay fires or its sequence ends
+            if (entity < timelineSequences.size() && SequenceScheduler::IsRunning(timelineSequences[entity])) {
+                SequenceScheduler::SetPaused(timelineSequences[entity], false);
+                continue;
+            }
+            if (entity < timelineDelays.size() && TimerWheel::IsPending(timelineDelays[entity])) {
                 continue;
             }
 
             // **Handle Transition In**
             if (timeline.IsTransitioningIn) {
-                timeline.DelayAccumulated += deltaTime; // Accumulate delay
-
-                if (timeline.DelayAccumulated < timeline.TransitionInDelay) {
+                if (WaitForDelay(entity, timeline.TransitionInDelay, timeline.DelayAccumulated, TimelineDelayIn, deltaTime)) {
                     continue; // Wait until transition in delay is over
                 }
 
+                if (RunSequencePhase(entity, timeline.TransitionInFunctionName)) {
+                    continue; // FinishTimelinePhase moves to Transition Out when the sequence ends
+                }
+
+                if (RunTweenPhase(entity, timeline, timeline.TransitionInFunctionName, deltaTime)) {
+                    continue; // FinishTimelinePhase moves to Transition Out
+                }
+
                 // Start the transition in
                 timeline.InternalTimer += deltaTime;
                 if (timeline.TransitionIn) {
@@ -91,12 +241,18 @@ namespace Framework {
 
             // **Handle Transition Out**
             else {
-                timeline.DelayOutAccumulated += deltaTime; // Accumulate out delay
-
-                if (timeline.DelayOutAccumulated < timeline.TransitionOutDelay) {
+                if (WaitForDelay(entity, timeline.TransitionOutDelay, timeline.DelayOutAccumulated, TimelineDelayOut, deltaTime)) {
                     continue; // Wait until transition out delay is over
                 }
 
+                if (RunSequencePhase(entity, timeline.TransitionOutFunctionName)) {
+                    continue; // FinishTimelinePhase deactivates the timeline when the sequence ends
+                }
+
+                if (RunTweenPhase(entity, timeline, timeline.TransitionOutFunctionName, deltaTime)) {
+                    continue; // FinishTimelinePhase deactivates the timeline
+                }
+
                 // Start the transition out
                 timeline.InternalTimer += deltaTime;
                 if (timeline.TransitionOut) {
@@ -109,23 +265,44 @@ namespace Framework {
                 }
             }
         }
+
+        // Every preset-driven phase advances here, one pass per tweened property
+        TweenEngine::Update(deltaTime);
     }
 
 
     void TimelineSystem::ToggleActive(std::string TimelineTag) {
-        bool activated = false;
+        std::size_t activated = 0;
 
-        for (auto const& entity : mEntities) {
-            auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
+        // Timelines are tagged with their TimelineTag by Update, so only the matches are visited
+        for (Entity entity : TagIndex::EntitiesWith(TagIndex::Intern(TimelineTag))) {
+            if (!CheckedHasComponent<TimelineComponent>(entity)) {
+                continue;
+            }
+            auto& timeline = CheckedGetComponent<TimelineComponent>(entity);
             if (timeline.TimelineTag == TimelineTag) {
                 timeline.Active = true;
-                activated = true;
-                std::cout << "Timeline with tag '" << TimelineTag << "' activated for entity " << entity << ".\n";
+                ++activated;
+            }
+        }
+
+        // Timelines not updated yet since the scene loaded are not tagged
+        if (activated == 0) {
+            for (auto const& entity : mEntities) {
+                auto& timeline = CheckedGetComponent<TimelineComponent>(entity);
+                if (timeline.TimelineTag == TimelineTag) {
+                    timeline.Active = true;
+                    ++activated;
+                }
             }
         }
-        if (!activated) {
+
+        if (activated == 0) {
             std::cerr << "Warning: No timeline with tag '" << TimelineTag << "' found to activate.\n";
         }
+        else {
+            std::cout << "Timeline with tag '" << TimelineTag << "' activated for " << activated << " entities.\n";
+        }
     }
 
 }
@@ -18,13 +18,29 @@
 #include "pch.h"
 #include <string>
 #include <functional>
+#include <vector>
 #include "System.h"
 #include "ComponentList.h"
+#include "SequenceScheduler.h"
+#include "SystemScheduler.h"
+#include "TagIndex.h"
+#include "TimerWheel.h"
+#include "TweenEngine.h"
 
 namespace Framework {
 
     class TimelineSystem : public ISystem {
     public:
+        // Of RenderComponent phases only fade and hide (alpha, isActive), so it runs beside AnimationSystem. Scene
+        // loads, prefab spawns and pausing from phase callbacks go through SystemScheduler::Defer; callbacks play
+        // audio and start the preloader, so it stays on the main thread
+        static constexpr SystemAccess Access{
+            SignatureOf<LayerComponent>,
+            SignatureOf<TimelineComponent, TransformComponent, RenderComponent, TextComponent>,
+            SystemMainThread,
+            SignatureOf<RenderComponent>,
+            FieldRenderAppearance };
+
         // Initialize the system and register necessary components
         void Initialize() override;
 
@@ -36,6 +52,45 @@ namespace Framework {
 
          void ToggleActive(std::string TimelineTag);
 
+        // A TimelineTag was edited (inspector, undo/redo), the cached tags are interned again on the next update
+        static void TimelineTagsEdited() { ++timelineTagEdits; }
+
+    private:
+        // Plays the tween preset named by a phase, false if the phase has no preset and runs its std::function
+        bool RunTweenPhase(Entity entity, TimelineComponent& timeline, const std::string& functionName, float deltaTime);
+
+        // Starts the sequence registered under a phase's name, false if there is none
+        bool RunSequencePhase(Entity entity, const std::string& functionName);
+
+        // Schedules the rest of a phase's delay on the timer wheel, false once the delay is over
+        bool WaitForDelay(Entity entity, float delay, float& accumulated, std::uint32_t event, float deltaTime);
+
+        // Cancels a pending delay of a hidden or inactive timeline, keeping the time waited in its accumulator
+        void ParkDelay(Entity entity, TimelineComponent& timeline);
+
+        // Tween of each entity's current phase, indexed by entity
+        std::vector<TweenHandle> timelineTweens;
+
+        // Pending transition delay of each entity, indexed by entity; the entity is skipped until it fires
+        std::vector<TimerHandle> timelineDelays;
+
+        // Sequence running a phase of each entity, indexed by entity; the entity is skipped until it ends
+        std::vector<SequenceHandle> timelineSequences;
+
+        // Interned TimelineTag of an entity, with the tag import and edit count it was interned for
+        struct CachedTimelineTag {
+            TagId tag = TagIndex::NoTag;
+            std::uint32_t generation = 0;
+            std::uint32_t edits = 0;
+        };
+
+        // Indexed by entity; interned again only when the entity is re-imported or a tag is edited
+        std::vector<CachedTimelineTag> timelineTags;
+
+        static std::uint32_t timelineTagEdits;
+
+        // Play mode as of the last update, the running tweens, delays and sequences are dropped once when it stops
+        bool wasPlaying = false;
 
     };
 
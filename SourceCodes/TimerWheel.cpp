@@ -0,0 +1,279 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TimerWheel.cpp
+///
+/// @brief Timer slots, cascading between levels and the per-tick firing.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cmath>
+#include "EngineState.h"
+
+namespace Framework {
+
+	std::vector<TimerWheel::Timer> TimerWheel::timers{};
+	std::vector<std::uint32_t> TimerWheel::freeTimers{};
+	std::array<TimerWheel::Wheel, static_cast<std::size_t>(TimerClock::Count)> TimerWheel::wheels{};
+	std::uint64_t TimerWheel::nextSequence{};
+	std::vector<TimerHandle> TimerWheel::dueScratch{};
+
+	void TimerWheel::Insert(Wheel& wheel, std::uint32_t index)
+	{
+		Timer& timer = timers[index];
+
+		// Past the last level the timer waits in its farthest slot and is placed again when that comes up
+		std::uint64_t due = std::max(timer.due, wheel.tick);
+		std::uint64_t delta = due - wheel.tick;
+		if (delta > MaxDelta)
+		{
+			delta = MaxDelta;
+			due = wheel.tick + MaxDelta;
+		}
+
+		std::uint32_t slot = 0;
+		if (delta < RootSlots)
+		{
+			slot = static_cast<std::uint32_t>(due & (RootSlots - 1));
+		}
+		else
+		{
+			std::uint32_t level = 0;
+			while (delta >= (1ull << (RootBits + (level + 1) * LevelBits)))
+			{
+				++level;
+			}
+			std::uint32_t levelSlot = static_cast<std::uint32_t>((due >> (RootBits + level * LevelBits)) & (LevelSlots - 1));
+			slot = RootSlots + level * LevelSlots + levelSlot;
+		}
+
+		timer.slot = slot;
+		timer.prev = None;
+		timer.next = wheel.heads[slot];
+		if (timer.next != None)
+		{
+			timers[timer.next].prev = index;
+		}
+		wheel.heads[slot] = index;
+		++wheel.count;
+	}
+
+	void TimerWheel::Unlink(Wheel& wheel, std::uint32_t index)
+	{
+		Timer& timer = timers[index];
+		if (timer.prev != None)
+		{
+			timers[timer.prev].next = timer.next;
+		}
+		else
+		{
+			wheel.heads[timer.slot] = timer.next;
+		}
+		if (timer.next != None)
+		{
+			timers[timer.next].prev = timer.prev;
+		}
+		timer.prev = None;
+		timer.next = None;
+		timer.slot = None;
+		--wheel.count;
+	}
+
+	void TimerWheel::Cascade(Wheel& wheel, std::uint32_t level, std::uint32_t slot)
+	{
+		std::uint32_t head = RootSlots + level * LevelSlots + slot;
+		std::uint32_t index = wheel.heads[head];
+		wheel.heads[head] = None;
+		while (index != None)
+		{
+			std::uint32_t next = timers[index].next;
+			--wheel.count;
+			Insert(wheel, index);
+			index = next;
+		}
+	}
+
+	void TimerWheel::Release(std::uint32_t index)
+	{
+		Timer& timer = timers[index];
+		++timer.generation;
+		timer.callback = nullptr;
+		freeTimers.push_back(index);
+	}
+
+	void TimerWheel::RunTick(Wheel& wheel)
+	{
+		std::uint64_t tick = wheel.tick;
+		std::uint32_t slot = static_cast<std::uint32_t>(tick & (RootSlots - 1));
+
+		// Each time the root wraps, the next block of every level that wrapped moves down
+		if (slot == 0)
+		{
+			for (std::uint32_t level = 0; level < Levels; ++level)
+			{
+				std::uint32_t levelSlot = static_cast<std::uint32_t>((tick >> (RootBits + level * LevelBits)) & (LevelSlots - 1));
+				Cascade(wheel, level, levelSlot);
+				if (levelSlot != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		// Callbacks scheduling again land on a later tick, never in the slot being fired
+		wheel.tick = tick + 1;
+		if (wheel.heads[slot] == None)
+		{
+			return;
+		}
+
+		// Swapped out so a nested tick (a callback advancing the wheel) gets its own list
+		std::vector<TimerHandle> due;
+		due.swap(dueScratch);
+		for (std::uint32_t index = wheel.heads[slot]; index != None; index = timers[index].next)
+		{
+			due.push_back({ index, timers[index].generation });
+		}
+		while (wheel.heads[slot] != None)
+		{
+			Unlink(wheel, wheel.heads[slot]);
+		}
+		std::sort(due.begin(), due.end(), [](const TimerHandle& a, const TimerHandle& b)
+		{
+			return timers[a.index].sequence < timers[b.index].sequence;
+		});
+
+		for (TimerHandle handle : due)
+		{
+			// Cancelled or cleared by an earlier callback
+			if (!IsPending(handle))
+			{
+				continue;
+			}
+			Timer& timer = timers[handle.index];
+			TimerCallback callback = timer.callback;
+			Entity entity = timer.entity;
+			std::uint32_t event = timer.event;
+			Release(handle.index);
+			callback(entity, event);
+		}
+
+		due.clear();
+		dueScratch.swap(due);
+	}
+
+	TimerHandle TimerWheel::Schedule(TimerClock clock, float delay, Entity entity, TimerCallback callback, std::uint32_t event)
+	{
+		if (!callback)
+		{
+			return {};
+		}
+
+		std::uint32_t index = 0;
+		if (!freeTimers.empty())
+		{
+			index = freeTimers.back();
+			freeTimers.pop_back();
+		}
+		else
+		{
+			index = static_cast<std::uint32_t>(timers.size());
+			timers.emplace_back();
+		}
+
+		// Tick t runs once the clock reaches t + 1
+		Wheel& wheel = WheelOf(clock);
+		float ticks = std::ceil(wheel.carry + std::max(delay, 0.0f) * TicksPerSecond);
+		std::uint64_t wait = (ticks > 1.0f) ? static_cast<std::uint64_t>(ticks) - 1 : 0;
+
+		Timer& timer = timers[index];
+		timer.due = wheel.tick + wait;
+		timer.sequence = nextSequence++;
+		timer.entity = entity;
+		timer.event = event;
+		timer.callback = callback;
+		timer.clock = clock;
+		Insert(wheel, index);
+		return { index, timer.generation };
+	}
+
+	void TimerWheel::Cancel(TimerHandle handle)
+	{
+		if (!IsPending(handle))
+		{
+			return;
+		}
+		if (timers[handle.index].slot != None)
+		{
+			Unlink(WheelOf(timers[handle.index].clock), handle.index);
+		}
+		Release(handle.index);
+	}
+
+	bool TimerWheel::IsPending(TimerHandle handle)
+	{
+		return handle.index < timers.size() && timers[handle.index].generation == handle.generation;
+	}
+
+	float TimerWheel::Remaining(TimerHandle handle)
+	{
+		if (!IsPending(handle))
+		{
+			return 0.0f;
+		}
+		const Timer& timer = timers[handle.index];
+		const Wheel& wheel = WheelOf(timer.clock);
+		float ticks = static_cast<float>(timer.due + 1 - wheel.tick) - wheel.carry;
+		return std::max(ticks, 0.0f) / TicksPerSecond;
+	}
+
+	void TimerWheel::Advance(float deltaTime)
+	{
+		if (deltaTime <= 0.0f)
+		{
+			return;
+		}
+
+		for (std::size_t clock = 0; clock < wheels.size(); ++clock)
+		{
+			if (static_cast<TimerClock>(clock) == TimerClock::Gameplay && engineState.IsPaused())
+			{
+				continue;
+			}
+
+			Wheel& wheel = wheels[clock];
+			wheel.carry += deltaTime * TicksPerSecond;
+			std::uint64_t ticks = static_cast<std::uint64_t>(wheel.carry);
+			wheel.carry -= static_cast<float>(ticks);
+
+			// An empty wheel has nothing to cascade, so its ticks are skipped in one step
+			for (; ticks > 0 && wheel.count > 0; --ticks)
+			{
+				RunTick(wheel);
+			}
+			wheel.tick += ticks;
+		}
+	}
+
+	void TimerWheel::Clear()
+	{
+		for (std::uint32_t index = 0; index < timers.size(); ++index)
+		{
+			if (timers[index].callback)
+			{
+				timers[index].slot = None;
+				Release(index);
+			}
+		}
+		for (Wheel& wheel : wheels)
+		{
+			wheel.heads = EmptySlots();
+			wheel.count = 0;
+		}
+	}
+}
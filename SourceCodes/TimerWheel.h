@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TimerWheel.h
+///
+/// @brief Hierarchical timer wheel for delays and cooldowns. A system
+///        schedules "wake entity X with event Y in T seconds" and the entity
+///        costs nothing until then: timers sit in the slot of the millisecond
+///        they are due (level 0, the next 256 ms) or of a coarser block
+///        (levels 1 to 3, 64 slots each) and move down a level as the block
+///        comes up, so an update only touches the slots it passes over.
+///
+///        Timers due on the same tick fire in the order they were scheduled.
+///        The Gameplay clock stops while engineState is paused, the Interface
+///        clock keeps running for menus and transitions that play while the
+///        game is paused.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ComponentList.h"
+
+namespace Framework {
+
+	enum class TimerClock : std::uint8_t
+	{
+		Gameplay,   // Stops while the engine is paused, e.g. enemy spawns
+		Interface,  // Runs while paused, e.g. timeline delays, button cooldowns
+		Count
+	};
+
+	// Called once when a timer is due; the timer is no longer pending by then, so it may schedule again
+	using TimerCallback = void (*)(Entity entity, std::uint32_t event);
+
+	// Generation checked, a handle of a fired or cancelled timer is simply not pending
+	struct TimerHandle
+	{
+		std::uint32_t index = ~0u;
+		std::uint32_t generation = 0;
+	};
+
+	class TimerWheel
+	{
+	public:
+		/**
+		 * @brief Calls callback(entity, event) once delay seconds of the clock have passed.
+		 *
+		 * @param delay : seconds, rounded up to the next millisecond; 0 fires once the clock moves a millisecond
+		 */
+		static TimerHandle Schedule(TimerClock clock, float delay, Entity entity, TimerCallback callback, std::uint32_t event = 0);
+
+		static void Cancel(TimerHandle handle);
+
+		static bool IsPending(TimerHandle handle);
+
+		// Seconds until a pending timer fires, 0 otherwise
+		static float Remaining(TimerHandle handle);
+
+		/**
+		 * @brief Advances the clocks by deltaTime, Gameplay first and only if the engine is not paused,
+		 *        firing the timers they pass in due order.
+		 */
+		static void Advance(float deltaTime);
+
+		/**
+		 * @brief Drops every timer without calling it, e.g. when leaving play mode; safe to call from a callback.
+		 */
+		static void Clear();
+
+		static std::size_t GetPendingCount() { return timers.size() - freeTimers.size(); }
+
+		static constexpr float TicksPerSecond = 1000.0f;
+
+	private:
+		static constexpr std::uint32_t RootBits = 8;
+		static constexpr std::uint32_t LevelBits = 6;
+		static constexpr std::uint32_t RootSlots = 1u << RootBits;
+		static constexpr std::uint32_t LevelSlots = 1u << LevelBits;
+		static constexpr std::uint32_t Levels = 3;   // Above the root
+		static constexpr std::uint32_t SlotCount = RootSlots + Levels * LevelSlots;
+		static constexpr std::uint64_t MaxDelta = (1ull << (RootBits + Levels * LevelBits)) - 1;  // About 18.6 hours
+		static constexpr std::uint32_t None = ~0u;
+
+		struct Timer
+		{
+			std::uint64_t due = 0;          // Tick of its clock
+			std::uint64_t sequence = 0;     // Schedule order, breaks ties between timers due on the same tick
+			Entity entity = 0;
+			std::uint32_t event = 0;
+			TimerCallback callback = nullptr;
+			std::uint32_t generation = 1;
+			std::uint32_t prev = None;
+			std::uint32_t next = None;
+			std::uint32_t slot = None;      // Into Wheel::heads, None while unlinked
+			TimerClock clock = TimerClock::Gameplay;
+		};
+
+		static constexpr std::array<std::uint32_t, SlotCount> EmptySlots()
+		{
+			std::array<std::uint32_t, SlotCount> slots{};
+			slots.fill(None);
+			return slots;
+		}
+
+		struct Wheel
+		{
+			std::array<std::uint32_t, SlotCount> heads = EmptySlots();
+			std::uint64_t tick = 0;         // Next tick to run
+			float carry = 0.0f;             // Fraction of a tick advanced past 'tick'
+			std::uint32_t count = 0;        // Linked timers
+		};
+
+		static void Insert(Wheel& wheel, std::uint32_t index);
+		static void Unlink(Wheel& wheel, std::uint32_t index);
+		static void Cascade(Wheel& wheel, std::uint32_t level, std::uint32_t slot);
+		static void RunTick(Wheel& wheel);
+		static void Release(std::uint32_t index);
+		static Wheel& WheelOf(TimerClock clock) { return wheels[static_cast<std::size_t>(clock)]; }
+
+		static std::vector<Timer> timers;
+		static std::vector<std::uint32_t> freeTimers;
+		static std::array<Wheel, static_cast<std::size_t>(TimerClock::Count)> wheels;
+		static std::uint64_t nextSequence;
+		static std::vector<TimerHandle> dueScratch;   // Kept between ticks so firing does not allocate
+	};
+}
+#endif // !_TIMER_WHEEL_H_
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AssetCooker.cpp
+///
+/// @brief Standalone tool that cooks every texture listed in TextureAsset.json
+///        into a GPU-ready .ctex file under Assets/Cooked (see CookedTexture.h):
+///        decoded RGBA8, premultiplied alpha and a pre-built mip chain, so the
+///        engine maps the file and uploads it without decoding PNGs at runtime.
+///
+///        Cooked files record a hash of their source image; unchanged sources
+///        are skipped, so re-running after editing a few images only cooks those.
+///
+///        Usage (from x64/Release, where the Assets folder lives):
+///          AssetCooker [--manifest Assets/JsonData/TextureAsset.json]
+///                      [--force] [--straight-alpha]
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#include "CookedTexture.h"
+
+namespace Framework {
+
+    enum class CookResult
+    {
+        Cooked,
+        UpToDate,
+        Failed
+    };
+
+    static bool ReadFile(const std::string& path, std::vector<std::uint8_t>& bytes)
+    {
+        std::ifstream input(path, std::ios::binary);
+        if (!input)
+        {
+            return false;
+        }
+        bytes.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    static CookResult CookTexture(const std::string& sourcePath, bool force, bool premultiply)
+    {
+        std::vector<std::uint8_t> source;
+        if (!ReadFile(sourcePath, source) || source.empty())
+        {
+            std::cerr << "  missing source " << sourcePath << "\n";
+            return CookResult::Failed;
+        }
+
+        std::string cookedPath = CookedTexture::CookedPathFor(sourcePath);
+        std::uint64_t sourceHash = CookedTexture::HashBytes(source.data(), source.size());
+
+        CookedTextureHeader existing{};
+        if (!force && CookedTexture::ReadHeader(cookedPath, existing) && existing.sourceHash == sourceHash
+            && ((existing.flags & CookedTexturePremultiplied) != 0) == premultiply)
+        {
+            return CookResult::UpToDate;
+        }
+
+        // Same decode as the AssetManager, rows stay top first
+        int width = 0, height = 0, channels = 0;
+        stbi_uc* pixels = stbi_load_from_memory(source.data(), static_cast<int>(source.size()), &width, &height, &channels, 4);
+        if (pixels == nullptr)
+        {
+            std::cerr << "  cannot decode " << sourcePath << ": " << stbi_failure_reason() << "\n";
+            return CookResult::Failed;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(cookedPath).parent_path(), error);
+        bool written = CookedTexture::Write(cookedPath, pixels, static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(height),
+            premultiply, sourceHash);
+        stbi_image_free(pixels);
+
+        if (!written)
+        {
+            std::cerr << "  cannot write " << cookedPath << "\n";
+            return CookResult::Failed;
+        }
+        return CookResult::Cooked;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Framework;
+
+    std::string manifestPath = "Assets/JsonData/TextureAsset.json";
+    bool force = false;
+    bool premultiply = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--manifest" && i + 1 < argc)
+        {
+            manifestPath = argv[++i];
+        }
+        else if (arg == "--force")
+        {
+            force = true;
+        }
+        else if (arg == "--straight-alpha")
+        {
+            premultiply = false;
+        }
+        else
+        {
+            std::cerr << "Usage: AssetCooker [--manifest TextureAsset.json] [--force] [--straight-alpha]\n";
+            return 1;
+        }
+    }
+
+    std::vector<std::uint8_t> manifestBytes;
+    if (!ReadFile(manifestPath, manifestBytes))
+    {
+        std::cerr << "Cannot open " << manifestPath << "\n";
+        return 1;
+    }
+
+    rapidjson::Document manifest;
+    manifest.Parse(reinterpret_cast<const char*>(manifestBytes.data()), manifestBytes.size());
+    if (manifest.HasParseError() || !manifest.HasMember("textures") || !manifest["textures"].IsArray())
+    {
+        std::cerr << manifestPath << " has no \"textures\" array\n";
+        return 1;
+    }
+
+    int cooked = 0, upToDate = 0, failed = 0;
+    for (const rapidjson::Value& texture : manifest["textures"].GetArray())
+    {
+        if (!texture.HasMember("path") || !texture["path"].IsString())
+        {
+            continue;
+        }
+
+        std::string sourcePath = texture["path"].GetString();
+        switch (CookTexture(sourcePath, force, premultiply))
+        {
+        case CookResult::Cooked:
+            std::cout << "cooked " << sourcePath << " -> " << CookedTexture::CookedPathFor(sourcePath) << "\n";
+            ++cooked;
+            break;
+        case CookResult::UpToDate:
+            ++upToDate;
+            break;
+        case CookResult::Failed:
+            ++failed;
+            break;
+        }
+    }
+
+    std::cout << cooked << " cooked, " << upToDate << " up to date, " << failed << " failed\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file AssetPacker.cpp
+///
+/// @brief Standalone tool that packs every file under an asset folder into a
+///        single archive (see AssetArchive.h) which the engine memory maps at
+///        startup instead of opening hundreds of loose files. Entries are
+///        keyed by their path relative to the working directory, the same
+///        strings the engine loads them by, and LZ4 compressed when that
+///        saves at least an eighth of their size.
+///
+///        Run AssetCooker and SpriteTrimmer first so cooked textures and
+///        trimmed animation atlases are packed too.
+///
+///        Usage (from x64/Release, where the Assets folder lives):
+///          AssetPacker [--root Assets] [--out Assets.pak] [--no-compress]
+///                      [--exclude <path prefix>]...
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AssetArchive.h"
+
+int main(int argc, char** argv)
+{
+    using namespace Framework;
+
+    std::string root = "Assets";
+    std::string outputPath = "Assets.pak";
+    bool compress = true;
+    std::vector<std::string> excludes;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--root" && hasValue)
+        {
+            root = argv[++i];
+        }
+        else if (arg == "--out" && hasValue)
+        {
+            outputPath = argv[++i];
+        }
+        else if (arg == "--no-compress")
+        {
+            compress = false;
+        }
+        else if (arg == "--exclude" && hasValue)
+        {
+            excludes.push_back(AssetArchive::NormalizePath(argv[++i]));
+        }
+        else
+        {
+            std::cerr << "Usage: AssetPacker [--root Assets] [--out Assets.pak] [--no-compress] [--exclude <path prefix>]...\n";
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    if (!std::filesystem::is_directory(root, error))
+    {
+        std::cerr << root << " is not a directory\n";
+        return 1;
+    }
+
+    std::vector<AssetArchiveSource> sources;
+    for (const auto& file : std::filesystem::recursive_directory_iterator(root, error))
+    {
+        if (!file.is_regular_file())
+        {
+            continue;
+        }
+
+        std::string path = AssetArchive::NormalizePath(file.path().generic_string());
+        bool excluded = std::any_of(excludes.begin(), excludes.end(), [&](const std::string& prefix)
+        {
+            return path.compare(0, prefix.size(), prefix) == 0;
+        });
+        if (!excluded)
+        {
+            sources.push_back({ path, file.path().string() });
+        }
+    }
+
+    // Stable output for identical inputs
+    std::sort(sources.begin(), sources.end(), [](const AssetArchiveSource& a, const AssetArchiveSource& b)
+    {
+        return a.archivePath < b.archivePath;
+    });
+
+    if (!AssetArchive::Write(outputPath, sources, compress))
+    {
+        std::cerr << "Failed to write " << outputPath << "\n";
+        return 1;
+    }
+
+    if (!AssetArchive::Mount(outputPath))
+    {
+        std::cerr << outputPath << " does not read back\n";
+        return 1;
+    }
+
+    std::uintmax_t archiveBytes = std::filesystem::file_size(outputPath, error);
+    std::cout << "Packed " << sources.size() << " files into " << outputPath << " (" << archiveBytes / 1024 << " KB)\n";
+    AssetArchive::Unmount();
+    return 0;
+}
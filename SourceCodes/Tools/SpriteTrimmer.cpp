@@ -0,0 +1,398 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file SpriteTrimmer.cpp
+///
+/// @brief Standalone tool that imports the uniform-grid animation sheets
+///        listed in AnimationAsset.json into trimmed atlases. Every frame is
+///        cropped to its opaque bounds, identical frames are stored once, and
+///        the survivors are shelf packed into a cooked texture (see
+///        CookedTexture.h). Per-frame atlas rects and offsets within the
+///        original cell are written to AnimationFrames.json next to
+///        AnimationAsset.json, which SpriteFrames loads at startup.
+///
+///        Re-run after editing a sheet or its rows / cols; a sheet whose
+///        atlas would not be smaller than the grid is left out.
+///
+///        Usage (from x64/Release, where the Assets folder lives):
+///          SpriteTrimmer [--animations Assets/JsonData/AnimationAsset.json]
+///                        [--textures Assets/JsonData/TextureAsset.json]
+///                        [--out Assets/JsonData/AnimationFrames.json]
+///                        [--straight-alpha]
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rapidjson/document.h"
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#include "CookedTexture.h"
+#include "SpriteFrames.h"
+
+namespace Framework {
+
+    // Transparent gap between packed frames, so filtering and the first mips do not pick up neighbours
+    static constexpr int FramePadding = 2;
+
+    struct TrimmedCell
+    {
+        int x = 0, y = 0;               // Opaque bounds within the cell, top row first
+        int width = 0, height = 0;
+        std::uint64_t hash = 0;
+        int atlasX = 0, atlasY = 0;
+        int unique = -1;                // Index among unique frames
+    };
+
+    struct ImportedSheet
+    {
+        std::string name;
+        std::string sourcePath;
+        int rows = 1;
+        int cols = 1;
+    };
+
+    static bool ReadFile(const std::string& path, std::vector<std::uint8_t>& bytes)
+    {
+        std::ifstream input(path, std::ios::binary);
+        if (!input)
+        {
+            return false;
+        }
+        bytes.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    static bool ParseJson(const std::string& path, rapidjson::Document& document, std::vector<std::uint8_t>& bytes)
+    {
+        if (!ReadFile(path, bytes))
+        {
+            std::cerr << "Cannot open " << path << "\n";
+            return false;
+        }
+        document.Parse(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        if (document.HasParseError() || !document.IsObject())
+        {
+            std::cerr << path << " is not valid JSON\n";
+            return false;
+        }
+        return true;
+    }
+
+    static void TrimCell(const std::uint8_t* pixels, int imageWidth, int cellX, int cellY, int cellWidth, int cellHeight, TrimmedCell& cell)
+    {
+        int minX = cellWidth, minY = cellHeight, maxX = -1, maxY = -1;
+        for (int y = 0; y < cellHeight; ++y)
+        {
+            const std::uint8_t* row = pixels + (static_cast<std::size_t>(cellY + y) * imageWidth + cellX) * 4;
+            for (int x = 0; x < cellWidth; ++x)
+            {
+                if (row[x * 4 + 3] != 0)
+                {
+                    minX = std::min(minX, x);
+                    maxX = std::max(maxX, x);
+                    minY = std::min(minY, y);
+                    maxY = std::max(maxY, y);
+                }
+            }
+        }
+
+        if (maxX < 0)
+        {
+            // Fully transparent, drawn as nothing
+            cell = TrimmedCell{};
+            return;
+        }
+
+        cell.x = minX;
+        cell.y = minY;
+        cell.width = maxX - minX + 1;
+        cell.height = maxY - minY + 1;
+
+        // Size and offset are part of the identity, equal pixels elsewhere in the cell are a different frame
+        std::uint32_t placement[4] = { static_cast<std::uint32_t>(cell.x), static_cast<std::uint32_t>(cell.y),
+            static_cast<std::uint32_t>(cell.width), static_cast<std::uint32_t>(cell.height) };
+        cell.hash = CookedTexture::HashBytes(placement, sizeof(placement));
+        for (int y = 0; y < cell.height; ++y)
+        {
+            const std::uint8_t* row = pixels + (static_cast<std::size_t>(cellY + cell.y + y) * imageWidth + cellX + cell.x) * 4;
+            cell.hash ^= CookedTexture::HashBytes(row, static_cast<std::size_t>(cell.width) * 4) + 0x9e3779b97f4a7c15ull + (cell.hash << 6) + (cell.hash >> 2);
+        }
+    }
+
+    static bool SamePixels(const std::uint8_t* pixels, int imageWidth, int cellWidth, int cellHeight, int cols,
+        const TrimmedCell& a, int indexA, const TrimmedCell& b, int indexB)
+    {
+        if (a.x != b.x || a.y != b.y || a.width != b.width || a.height != b.height)
+        {
+            return false;
+        }
+        for (int y = 0; y < a.height; ++y)
+        {
+            const std::uint8_t* rowA = pixels + (static_cast<std::size_t>((indexA / cols) * cellHeight + a.y + y) * imageWidth + (indexA % cols) * cellWidth + a.x) * 4;
+            const std::uint8_t* rowB = pixels + (static_cast<std::size_t>((indexB / cols) * cellHeight + b.y + y) * imageWidth + (indexB % cols) * cellWidth + b.x) * 4;
+            if (std::memcmp(rowA, rowB, static_cast<std::size_t>(a.width) * 4) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Shelf packs the unique frames, tallest first, into the narrowest-reasonable atlas
+    static void PackFrames(std::vector<TrimmedCell>& cells, const std::vector<int>& uniqueCells, int& atlasWidth, int& atlasHeight)
+    {
+        std::vector<int> order = uniqueCells;
+        std::sort(order.begin(), order.end(), [&](int a, int b)
+        {
+            return cells[a].height != cells[b].height ? cells[a].height > cells[b].height : a < b;
+        });
+
+        std::size_t area = 0;
+        int widest = 1;
+        for (int index : order)
+        {
+            area += static_cast<std::size_t>(cells[index].width + FramePadding) * (cells[index].height + FramePadding);
+            widest = std::max(widest, cells[index].width + FramePadding);
+        }
+        atlasWidth = std::max(widest, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(area)))));
+        atlasWidth = (atlasWidth + 3) & ~3;
+
+        int x = 0, y = 0, shelfHeight = 0;
+        for (int index : order)
+        {
+            TrimmedCell& cell = cells[index];
+            if (x + cell.width + FramePadding > atlasWidth)
+            {
+                x = 0;
+                y += shelfHeight;
+                shelfHeight = 0;
+            }
+            cell.atlasX = x;
+            cell.atlasY = y;
+            x += cell.width + FramePadding;
+            shelfHeight = std::max(shelfHeight, cell.height + FramePadding);
+        }
+        atlasHeight = std::max(1, y + shelfHeight);
+    }
+
+    static bool TrimSheet(const ImportedSheet& sheet, bool premultiply, std::ostream& json, bool& first)
+    {
+        std::vector<std::uint8_t> source;
+        if (!ReadFile(sheet.sourcePath, source) || source.empty())
+        {
+            std::cerr << "  missing source " << sheet.sourcePath << "\n";
+            return false;
+        }
+
+        int width = 0, height = 0, channels = 0;
+        stbi_uc* pixels = stbi_load_from_memory(source.data(), static_cast<int>(source.size()), &width, &height, &channels, 4);
+        if (pixels == nullptr)
+        {
+            std::cerr << "  cannot decode " << sheet.sourcePath << ": " << stbi_failure_reason() << "\n";
+            return false;
+        }
+
+        int cellWidth = width / sheet.cols;
+        int cellHeight = height / sheet.rows;
+        int frameCount = sheet.rows * sheet.cols;
+        std::vector<TrimmedCell> cells(static_cast<std::size_t>(frameCount));
+        std::vector<int> uniqueCells;
+        std::unordered_multimap<std::uint64_t, int> byHash;
+
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            TrimmedCell& cell = cells[frame];
+            TrimCell(pixels, width, (frame % sheet.cols) * cellWidth, (frame / sheet.cols) * cellHeight, cellWidth, cellHeight, cell);
+
+            auto range = byHash.equal_range(cell.hash);
+            for (auto candidate = range.first; candidate != range.second; ++candidate)
+            {
+                const TrimmedCell& other = cells[candidate->second];
+                if (SamePixels(pixels, width, cellWidth, cellHeight, sheet.cols, cell, frame, other, candidate->second))
+                {
+                    cell.unique = other.unique;
+                    break;
+                }
+            }
+            if (cell.unique < 0)
+            {
+                cell.unique = static_cast<int>(uniqueCells.size());
+                uniqueCells.push_back(frame);
+                byHash.emplace(cell.hash, frame);
+            }
+        }
+
+        int atlasWidth = 0, atlasHeight = 0;
+        PackFrames(cells, uniqueCells, atlasWidth, atlasHeight);
+
+        if (static_cast<std::size_t>(atlasWidth) * atlasHeight >= static_cast<std::size_t>(width) * height)
+        {
+            std::cout << "  " << sheet.name << ": trimmed atlas is not smaller, keeping the grid\n";
+            stbi_image_free(pixels);
+            return true;
+        }
+
+        std::vector<std::uint8_t> atlas(static_cast<std::size_t>(atlasWidth) * atlasHeight * 4, 0);
+        for (int frame : uniqueCells)
+        {
+            const TrimmedCell& cell = cells[frame];
+            for (int y = 0; y < cell.height; ++y)
+            {
+                const std::uint8_t* from = pixels + (static_cast<std::size_t>((frame / sheet.cols) * cellHeight + cell.y + y) * width + (frame % sheet.cols) * cellWidth + cell.x) * 4;
+                std::uint8_t* to = atlas.data() + (static_cast<std::size_t>(cell.atlasY + y) * atlasWidth + cell.atlasX) * 4;
+                std::memcpy(to, from, static_cast<std::size_t>(cell.width) * 4);
+            }
+        }
+        stbi_image_free(pixels);
+
+        std::string atlasPath = SpriteFrames::AtlasPathFor(sheet.sourcePath);
+        std::string cookedPath = CookedTexture::CookedPathFor(atlasPath);
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(cookedPath).parent_path(), error);
+        if (!CookedTexture::Write(cookedPath, atlas.data(), static_cast<std::uint32_t>(atlasWidth), static_cast<std::uint32_t>(atlasHeight),
+            premultiply, CookedTexture::HashBytes(source.data(), source.size())))
+        {
+            std::cerr << "  cannot write " << cookedPath << "\n";
+            return false;
+        }
+
+        json << (first ? "" : ",\n") << "    {\n"
+            << "      \"name\": \"" << sheet.name << "\",\n"
+            << "      \"atlas\": \"" << atlasPath << "\",\n"
+            << "      \"atlasWidth\": " << atlasWidth << ", \"atlasHeight\": " << atlasHeight << ",\n"
+            << "      \"cellWidth\": " << cellWidth << ", \"cellHeight\": " << cellHeight << ",\n"
+            << "      \"frames\": [\n";
+        for (std::size_t i = 0; i < uniqueCells.size(); ++i)
+        {
+            const TrimmedCell& cell = cells[uniqueCells[i]];
+            json << "        { \"x\": " << cell.atlasX << ", \"y\": " << cell.atlasY << ", \"w\": " << cell.width << ", \"h\": " << cell.height
+                << ", \"offsetX\": " << cell.x << ", \"offsetY\": " << cell.y << " }" << (i + 1 < uniqueCells.size() ? ",\n" : "\n");
+        }
+        json << "      ],\n      \"sequence\": [ ";
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            json << cells[frame].unique << (frame + 1 < frameCount ? ", " : " ");
+        }
+        json << "]\n    }";
+        first = false;
+
+        std::cout << "  " << sheet.name << ": " << frameCount << " frames, " << uniqueCells.size() << " unique, "
+            << width << "x" << height << " -> " << atlasWidth << "x" << atlasHeight << "\n";
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Framework;
+
+    std::string animationsPath = "Assets/JsonData/AnimationAsset.json";
+    std::string texturesPath = "Assets/JsonData/TextureAsset.json";
+    std::string outputPath = "Assets/JsonData/AnimationFrames.json";
+    bool premultiply = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--animations" && hasValue)
+        {
+            animationsPath = argv[++i];
+        }
+        else if (arg == "--textures" && hasValue)
+        {
+            texturesPath = argv[++i];
+        }
+        else if (arg == "--out" && hasValue)
+        {
+            outputPath = argv[++i];
+        }
+        else if (arg == "--straight-alpha")
+        {
+            premultiply = false;
+        }
+        else
+        {
+            std::cerr << "Usage: SpriteTrimmer [--animations AnimationAsset.json] [--textures TextureAsset.json] [--out AnimationFrames.json] [--straight-alpha]\n";
+            return 1;
+        }
+    }
+
+    std::vector<std::uint8_t> animationBytes, textureBytes;
+    rapidjson::Document animations, textures;
+    if (!ParseJson(animationsPath, animations, animationBytes) || !ParseJson(texturesPath, textures, textureBytes))
+    {
+        return 1;
+    }
+    if (!animations.HasMember("animations") || !animations["animations"].IsArray() || !textures.HasMember("textures") || !textures["textures"].IsArray())
+    {
+        std::cerr << "Expected an \"animations\" and a \"textures\" array\n";
+        return 1;
+    }
+
+    std::unordered_map<std::string, std::string> texturePaths;
+    for (const rapidjson::Value& texture : textures["textures"].GetArray())
+    {
+        if (texture.HasMember("name") && texture.HasMember("path") && texture["name"].IsString() && texture["path"].IsString())
+        {
+            texturePaths.emplace(texture["name"].GetString(), texture["path"].GetString());
+        }
+    }
+
+    std::vector<ImportedSheet> sheets;
+    for (const rapidjson::Value& animation : animations["animations"].GetArray())
+    {
+        if (!animation.HasMember("name") || !animation.HasMember("rows") || !animation.HasMember("cols"))
+        {
+            continue;
+        }
+        ImportedSheet sheet;
+        sheet.name = animation["name"].GetString();
+        sheet.rows = std::max(1, animation["rows"].GetInt());
+        sheet.cols = std::max(1, animation["cols"].GetInt());
+
+        auto path = texturePaths.find(sheet.name);
+        if (path == texturePaths.end() || sheet.rows * sheet.cols == 1)
+        {
+            continue;
+        }
+        sheet.sourcePath = path->second;
+        sheets.push_back(sheet);
+    }
+
+    std::ofstream json(outputPath, std::ios::trunc);
+    if (!json)
+    {
+        std::cerr << "Cannot write " << outputPath << "\n";
+        return 1;
+    }
+    json << "{\n  \"sheets\": [\n";
+
+    int failed = 0;
+    bool first = true;
+    for (const ImportedSheet& sheet : sheets)
+    {
+        if (!TrimSheet(sheet, premultiply, json, first))
+        {
+            ++failed;
+        }
+    }
+    json << "\n  ]\n}\n";
+
+    std::cout << sheets.size() - failed << " of " << sheets.size() << " sheets imported into " << outputPath << "\n";
+    return failed == 0 ? 0 : 1;
+}
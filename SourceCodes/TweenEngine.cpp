@@ -0,0 +1,488 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TweenEngine.cpp
+///
+/// @brief Tween track pools, curve tables and the batched update.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "TweenEngine.h"
+#include <algorithm>
+#include <cmath>
+#include "Coordinator.h"
+#include "EngineState.h"
+#include "EntityView.h"
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework {
+
+	std::unordered_map<std::string, TweenPreset> TweenEngine::presets{};
+	std::array<TweenEngine::TrackPool, static_cast<std::size_t>(TweenProperty::Count)> TweenEngine::pools{};
+	std::vector<TweenEngine::Group> TweenEngine::groups{};
+	std::vector<std::uint32_t> TweenEngine::freeGroups{};
+	std::vector<std::uint8_t> TweenEngine::removedGroups{};
+	std::array<std::array<float, TweenEngine::CurveSegments + 1>, static_cast<std::size_t>(TweenCurve::Count)> TweenEngine::curves{};
+	bool TweenEngine::curvesBaked{};
+	std::uint32_t TweenEngine::clearCount{};
+
+	enum TrackState : std::uint8_t
+	{
+		TrackWaiting,   // Delay not over
+		TrackRunning,
+		TrackFinishing, // Reached its end this update, writes its last value once more
+		TrackDone
+	};
+
+	static constexpr float Pi = 3.14159265358979323846f;
+
+	static float EvaluateCurve(TweenCurve curve, float x)
+	{
+		switch (curve)
+		{
+		case TweenCurve::None:          return 0.0f;
+		case TweenCurve::Linear:        return x;
+		case TweenCurve::SmoothStep:    return x * x * (3.0f - 2.0f * x);
+		case TweenCurve::EaseOutQuad:   return x * (2.0f - x);
+		case TweenCurve::QuarterSine:   return std::sin(x * Pi * 0.5f);
+		case TweenCurve::QuarterCosine: return 1.0f - std::cos(x * Pi * 0.5f);
+		case TweenCurve::SineArch:      return std::sin(x * Pi);
+		case TweenCurve::ElasticBump:   return std::exp(-3.0f * x) * std::sin(1.1f * Pi * x);
+		case TweenCurve::Wobble:        return std::sin(10.0f * x) * (1.0f - x);
+		case TweenCurve::BounceSettle:  return std::exp(-4.0f * x) * std::sin(8.0f * Pi * x);
+		case TweenCurve::SineWave:      return std::sin(2.0f * Pi * x);
+		default:                        return 0.0f;
+		}
+	}
+
+	void TweenEngine::BakeCurves()
+	{
+		for (std::size_t curve = 0; curve < curves.size(); ++curve)
+		{
+			for (std::size_t i = 0; i <= CurveSegments; ++i)
+			{
+				curves[curve][i] = EvaluateCurve(static_cast<TweenCurve>(curve), static_cast<float>(i) / CurveSegments);
+			}
+		}
+		curvesBaked = true;
+	}
+
+	float TweenEngine::Sample(TweenCurve curve, float x)
+	{
+		const std::array<float, CurveSegments + 1>& table = curves[static_cast<std::size_t>(curve)];
+		float position = std::clamp(x, 0.0f, 1.0f) * CurveSegments;
+		std::size_t index = std::min(static_cast<std::size_t>(position), CurveSegments - 1);
+		float fraction = position - static_cast<float>(index);
+		return table[index] + (table[index + 1] - table[index]) * fraction;
+	}
+
+	void TweenEngine::RegisterPreset(const std::string& name, TweenPreset preset)
+	{
+		presets[name] = std::move(preset);
+	}
+
+	const TweenPreset* TweenEngine::FindPreset(const std::string& name)
+	{
+		auto preset = presets.find(name);
+		return (preset != presets.end()) ? &preset->second : nullptr;
+	}
+
+	float TweenEngine::ReadCurrent(Entity entity, TweenProperty property)
+	{
+		switch (property)
+		{
+		case TweenProperty::PositionX:
+		case TweenProperty::PositionY:
+		case TweenProperty::ScaleX:
+		case TweenProperty::ScaleY:
+			if (CheckedHasComponent<TransformComponent>(entity))
+			{
+				const TransformComponent& transform = CheckedGetComponent<TransformComponent>(entity);
+				switch (property)
+				{
+				case TweenProperty::PositionX: return transform.position.x;
+				case TweenProperty::PositionY: return transform.position.y;
+				case TweenProperty::ScaleX:    return transform.scale.x;
+				default:                       return transform.scale.y;
+				}
+			}
+			break;
+		case TweenProperty::Alpha:
+			if (CheckedHasComponent<RenderComponent>(entity))
+			{
+				return CheckedGetComponent<RenderComponent>(entity).alpha;
+			}
+			break;
+		case TweenProperty::FontSize:
+			if (CheckedHasComponent<TextComponent>(entity))
+			{
+				return static_cast<float>(CheckedGetComponent<TextComponent>(entity).fontSize);
+			}
+			break;
+		default:
+			break;
+		}
+		return 0.0f;
+	}
+
+	void TweenEngine::SpawnTracks(std::uint32_t groupIndex)
+	{
+		Group& group = groups[groupIndex];
+		const TweenParams& params = group.params;
+		auto resolve = [&](const TweenValue& value, TweenProperty property)
+		{
+			float base = 0.0f;
+			switch (value.source)
+			{
+			case TweenSource::Current:       base = ReadCurrent(group.entity, property); break;
+			case TweenSource::StartPosition: base = params.startPosition; break;
+			case TweenSource::EndPosition:   base = params.endPosition; break;
+			default:                         break;
+			}
+			return base * value.scale + value.offset + value.perDuration * params.duration;
+		};
+		auto seconds = [&](const TweenTime& time)
+		{
+			return time.durations * params.duration + time.seconds;
+		};
+
+		group.elapsed = 0.0f;
+		group.length = seconds(group.preset->length);
+		group.pendingTracks = static_cast<std::uint32_t>(group.preset->tracks.size());
+
+		for (const TweenTrackSpec& track : group.preset->tracks)
+		{
+			TrackPool& pool = pools[static_cast<std::size_t>(track.property)];
+			float duration = seconds(track.duration);
+			float from = resolve(track.from, track.property);
+
+			pool.elapsed.push_back(-seconds(track.delay));
+			pool.inverseDuration.push_back(duration > 0.0f ? 1.0f / duration : 1.0e30f);
+			pool.from.push_back(from);
+			pool.delta.push_back(resolve(track.to, track.property) - from);
+			pool.amplitude.push_back(track.amplitude);
+			pool.waveRate.push_back((track.wavePeriod > 0.0f && duration > 0.0f) ? duration / track.wavePeriod : 1.0f);
+			pool.values.push_back(from);
+			pool.ease.push_back(static_cast<std::uint8_t>(track.ease));
+			pool.wave.push_back(static_cast<std::uint8_t>(track.wave));
+			pool.state.push_back(TrackWaiting);
+			pool.group.push_back(groupIndex);
+			pool.entities.push_back(group.entity);
+		}
+	}
+
+	TweenHandle TweenEngine::Play(Entity entity, const TweenPreset& preset, const TweenParams& params, TweenFinishedCallback onFinished, std::uint32_t event)
+	{
+		if (!curvesBaked)
+		{
+			BakeCurves();
+		}
+
+		std::uint32_t index;
+		if (!freeGroups.empty())
+		{
+			index = freeGroups.back();
+			freeGroups.pop_back();
+		}
+		else
+		{
+			index = static_cast<std::uint32_t>(groups.size());
+			groups.emplace_back();
+		}
+
+		Group& group = groups[index];
+		group.entity = entity;
+		group.preset = &preset;
+		group.params = params;
+		group.onFinished = onFinished;
+		group.event = event;
+		group.active = true;
+		SpawnTracks(index);
+
+		TweenHandle handle{ index, group.generation };
+		if (preset.onStart)
+		{
+			preset.onStart(entity);
+		}
+		return handle;
+	}
+
+	bool TweenEngine::IsPlaying(TweenHandle handle)
+	{
+		return handle.index < groups.size() && groups[handle.index].active && groups[handle.index].generation == handle.generation;
+	}
+
+	void TweenEngine::Stop(TweenHandle handle)
+	{
+		if (!IsPlaying(handle))
+		{
+			return;
+		}
+		removedGroups.assign(groups.size(), 0);
+		removedGroups[handle.index] = 1;
+		RemoveTracks(removedGroups);
+
+		Group& group = groups[handle.index];
+		group.active = false;
+		++group.generation;
+		freeGroups.push_back(handle.index);
+	}
+
+	void TweenEngine::Evaluate(TrackPool& pool, float deltaTime)
+	{
+		const std::size_t count = pool.elapsed.size();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (groups[pool.group[i]].hidden)
+			{
+				continue;
+			}
+
+			std::uint8_t state = pool.state[i];
+			if (state >= TrackFinishing)
+			{
+				// The last value was written by the previous update, later tracks of the property take over
+				pool.state[i] = TrackDone;
+				continue;
+			}
+
+			float elapsed = pool.elapsed[i] + deltaTime;
+			pool.elapsed[i] = elapsed;
+			if (elapsed < 0.0f)
+			{
+				continue;
+			}
+
+			float progress = std::min(elapsed * pool.inverseDuration[i], 1.0f);
+			float wave = progress * pool.waveRate[i];
+			if (pool.waveRate[i] != 1.0f)
+			{
+				wave -= std::floor(wave);
+			}
+			pool.values[i] = pool.from[i] + pool.delta[i] * Sample(static_cast<TweenCurve>(pool.ease[i]), progress)
+				+ pool.amplitude[i] * Sample(static_cast<TweenCurve>(pool.wave[i]), wave);
+
+			if (progress >= 1.0f)
+			{
+				pool.state[i] = TrackFinishing;
+				--groups[pool.group[i]].pendingTracks;
+			}
+			else
+			{
+				pool.state[i] = TrackRunning;
+			}
+		}
+	}
+
+	// Writes the values of the tracks that ran this update into one component field
+	template <typename Component, typename Setter>
+	static void Scatter(const std::vector<std::uint8_t>& states, const std::vector<float>& values, const std::vector<Entity>& entities, Setter set)
+	{
+		const std::size_t count = values.size();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if ((states[i] == TrackRunning || states[i] == TrackFinishing) && CheckedHasComponent<Component>(entities[i]))
+			{
+				set(CheckedGetComponent<Component>(entities[i]), values[i]);
+			}
+		}
+	}
+
+	void TweenEngine::Apply(TweenProperty property, const TrackPool& pool)
+	{
+		switch (property)
+		{
+		case TweenProperty::PositionX:
+			Scatter<TransformComponent>(pool.state, pool.values, pool.entities, [](TransformComponent& transform, float value) { transform.position.x = value; });
+			break;
+		case TweenProperty::PositionY:
+			Scatter<TransformComponent>(pool.state, pool.values, pool.entities, [](TransformComponent& transform, float value) { transform.position.y = value; });
+			break;
+		case TweenProperty::ScaleX:
+			Scatter<TransformComponent>(pool.state, pool.values, pool.entities, [](TransformComponent& transform, float value) { transform.scale.x = value; });
+			break;
+		case TweenProperty::ScaleY:
+			Scatter<TransformComponent>(pool.state, pool.values, pool.entities, [](TransformComponent& transform, float value) { transform.scale.y = value; });
+			break;
+		case TweenProperty::Alpha:
+			Scatter<RenderComponent>(pool.state, pool.values, pool.entities, [](RenderComponent& render, float value) { render.alpha = value; });
+			break;
+		case TweenProperty::FontSize:
+			Scatter<TextComponent>(pool.state, pool.values, pool.entities, [](TextComponent& text, float value) { text.fontSize = static_cast<decltype(text.fontSize)>(value); });
+			break;
+		default:
+			break;
+		}
+	}
+
+	void TweenEngine::RemoveTracks(const std::vector<std::uint8_t>& removed)
+	{
+		for (TrackPool& pool : pools)
+		{
+			// Stable, later tracks of a property must stay after earlier ones
+			std::size_t kept = 0;
+			for (std::size_t i = 0; i < pool.elapsed.size(); ++i)
+			{
+				if (removed[pool.group[i]])
+				{
+					continue;
+				}
+				if (kept != i)
+				{
+					pool.elapsed[kept] = pool.elapsed[i];
+					pool.inverseDuration[kept] = pool.inverseDuration[i];
+					pool.from[kept] = pool.from[i];
+					pool.delta[kept] = pool.delta[i];
+					pool.amplitude[kept] = pool.amplitude[i];
+					pool.waveRate[kept] = pool.waveRate[i];
+					pool.values[kept] = pool.values[i];
+					pool.ease[kept] = pool.ease[i];
+					pool.wave[kept] = pool.wave[i];
+					pool.state[kept] = pool.state[i];
+					pool.group[kept] = pool.group[i];
+					pool.entities[kept] = pool.entities[i];
+				}
+				++kept;
+			}
+			pool.elapsed.resize(kept);
+			pool.inverseDuration.resize(kept);
+			pool.from.resize(kept);
+			pool.delta.resize(kept);
+			pool.amplitude.resize(kept);
+			pool.waveRate.resize(kept);
+			pool.values.resize(kept);
+			pool.ease.resize(kept);
+			pool.wave.resize(kept);
+			pool.state.resize(kept);
+			pool.group.resize(kept);
+			pool.entities.resize(kept);
+		}
+	}
+
+	void TweenEngine::Update(float deltaTime)
+	{
+		if (!curvesBaked)
+		{
+			BakeCurves();
+		}
+
+		// Layer visibility is looked up once per group rather than per track
+		for (Group& group : groups)
+		{
+			group.hidden = false;
+			if (group.active && ecsInterface.IsEntityValid(group.entity) && CheckedHasComponent<LayerComponent>(group.entity))
+			{
+				group.hidden = !engineState.layerVisibility[CheckedGetComponent<LayerComponent>(group.entity).layerID];
+			}
+		}
+
+		// One pass per property over its packed tracks
+		for (std::size_t property = 0; property < pools.size(); ++property)
+		{
+			Evaluate(pools[property], deltaTime);
+			Apply(static_cast<TweenProperty>(property), pools[property]);
+		}
+
+		// Index and generation, a callback may stop a group further down the list and reuse its slot
+		static std::vector<TweenHandle> finished;
+		finished.clear();
+		for (std::uint32_t index = 0; index < groups.size(); ++index)
+		{
+			Group& group = groups[index];
+			if (!group.active || group.hidden)
+			{
+				continue;
+			}
+			group.elapsed += deltaTime;
+			if (group.pendingTracks == 0 && group.elapsed >= group.length)
+			{
+				finished.push_back({ index, group.generation });
+			}
+		}
+		if (finished.empty())
+		{
+			return;
+		}
+
+		removedGroups.assign(groups.size(), 0);
+		for (TweenHandle handle : finished)
+		{
+			removedGroups[handle.index] = 1;
+		}
+		RemoveTracks(removedGroups);
+
+		// Callbacks may play, stop or clear tweens, so nothing of a group is referenced across one
+		const std::uint32_t clearsBefore = clearCount;
+		for (TweenHandle handle : finished)
+		{
+			if (!IsPlaying(handle))
+			{
+				continue;
+			}
+			Group& group = groups[handle.index];
+			if (group.preset->loop)
+			{
+				SpawnTracks(handle.index);
+				continue;
+			}
+
+			Entity entity = group.entity;
+			TweenCallback onComplete = group.preset->onComplete;
+			TweenFinishedCallback onFinished = group.onFinished;
+			std::uint32_t event = group.event;
+			group.active = false;
+			++group.generation;
+			freeGroups.push_back(handle.index);
+
+			if (onComplete && ecsInterface.IsEntityValid(entity))
+			{
+				onComplete(entity);
+			}
+			if (clearCount != clearsBefore)
+			{
+				return;
+			}
+			if (onFinished)
+			{
+				onFinished(entity, event);
+			}
+			if (clearCount != clearsBefore)
+			{
+				return;
+			}
+		}
+	}
+
+	void TweenEngine::Clear()
+	{
+		for (TrackPool& pool : pools)
+		{
+			pool = TrackPool{};
+		}
+		freeGroups.clear();
+		for (std::uint32_t index = 0; index < groups.size(); ++index)
+		{
+			if (groups[index].active)
+			{
+				groups[index].active = false;
+				++groups[index].generation;
+			}
+			freeGroups.push_back(index);
+		}
+		++clearCount;
+	}
+
+	std::size_t TweenEngine::GetTrackCount()
+	{
+		std::size_t count = 0;
+		for (const TrackPool& pool : pools)
+		{
+			count += pool.elapsed.size();
+		}
+		return count;
+	}
+}
@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file TweenEngine.h
+///
+/// @brief Batched tweens for timeline transitions. A preset is plain data: a
+///        list of typed tracks (position.x, position.y, scale, alpha, font
+///        size), each easing between two values along a curve and optionally
+///        adding a wave (elastic bump, wobble, blink) on top. Playing a preset
+///        appends its tracks to one struct-of-arrays pool per property; every
+///        update evaluates a whole pool in one pass from baked curve tables and
+///        writes the results into the components. Callbacks fire once, when a
+///        group starts and when all of its tracks have finished.
+///
+///        TimelineSystem plays the preset registered under a timeline's
+///        TransitionIn/OutFunctionName, the presets are declared next to the
+///        legacy behaviors in TimelineBehavior.h.
+///
+///	@Authors: Victor Lee
+///	Copyright 2024, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef _TWEEN_ENGINE_H_
+#define _TWEEN_ENGINE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ComponentList.h"
+
+namespace Framework {
+
+	enum class TweenProperty : std::uint8_t
+	{
+		PositionX,
+		PositionY,
+		ScaleX,
+		ScaleY,
+		Alpha,      // RenderComponent
+		FontSize,   // TextComponent
+		Count
+	};
+
+	// Curves are sampled over [0, 1], from baked tables
+	enum class TweenCurve : std::uint8_t
+	{
+		None,           // Always 0, for tracks without a wave
+		Linear,
+		SmoothStep,
+		EaseOutQuad,    // 2x - x^2
+		QuarterSine,    // sin(x pi/2)
+		QuarterCosine,  // 1 - cos(x pi/2)
+		SineArch,       // sin(x pi), out and back
+		ElasticBump,    // exp(-3x) sin(1.1 pi x)
+		Wobble,         // sin(10x) (1 - x)
+		BounceSettle,   // exp(-4x) sin(8 pi x)
+		SineWave,       // sin(2 pi x), repeats
+		Count
+	};
+
+	enum class TweenSource : std::uint8_t
+	{
+		Constant,
+		Current,        // The property's value when the group starts
+		StartPosition,  // TweenParams::startPosition
+		EndPosition     // TweenParams::endPosition
+	};
+
+	// source * scale + offset + perDuration * TweenParams::duration
+	struct TweenValue
+	{
+		TweenSource source = TweenSource::Constant;
+		float scale = 1.0f;
+		float offset = 0.0f;
+		float perDuration = 0.0f;
+
+		static TweenValue Constant(float value) { return { TweenSource::Constant, 0.0f, value, 0.0f }; }
+		static TweenValue Current(float scale = 1.0f, float perDuration = 0.0f) { return { TweenSource::Current, scale, 0.0f, perDuration }; }
+		static TweenValue Start(float scale = 1.0f) { return { TweenSource::StartPosition, scale, 0.0f, 0.0f }; }
+		static TweenValue End(float scale = 1.0f) { return { TweenSource::EndPosition, scale, 0.0f, 0.0f }; }
+	};
+
+	// durations * TweenParams::duration + seconds
+	struct TweenTime
+	{
+		float durations = 0.0f;
+		float seconds = 0.0f;
+
+		static TweenTime Durations(float count) { return { count, 0.0f }; }
+		static TweenTime Seconds(float count) { return { 0.0f, count }; }
+	};
+
+	struct TweenTrackSpec
+	{
+		TweenProperty property = TweenProperty::PositionX;
+		TweenValue from;
+		TweenValue to;
+		TweenCurve ease = TweenCurve::Linear;
+		TweenCurve wave = TweenCurve::None;     // Added on top, amplitude * wave
+		float amplitude = 0.0f;
+		float wavePeriod = 0.0f;                // Seconds per cycle of a repeating wave, 0 plays it once over the track
+		TweenTime duration = TweenTime::Durations(1.0f);
+		TweenTime delay;
+	};
+
+	using TweenCallback = void (*)(Entity entity);
+
+	// event is the value passed to Play, e.g. to find the owner of the tween
+	using TweenFinishedCallback = void (*)(Entity entity, std::uint32_t event);
+
+	struct TweenPreset
+	{
+		std::vector<TweenTrackSpec> tracks;
+		TweenTime length;                       // The group lasts at least this long, e.g. a preset without tracks
+		bool loop = false;                      // Restarts instead of finishing
+		TweenCallback onStart = nullptr;
+		TweenCallback onComplete = nullptr;
+	};
+
+	struct TweenParams
+	{
+		float duration = 1.0f;
+		float startPosition = 0.0f;
+		float endPosition = 0.0f;
+	};
+
+	// Generation checked, a handle of a finished or stopped group is simply not playing
+	struct TweenHandle
+	{
+		std::uint32_t index = ~0u;
+		std::uint32_t generation = 0;
+	};
+
+	class TweenEngine
+	{
+	public:
+		static void RegisterPreset(const std::string& name, TweenPreset preset);
+
+		// nullptr if no preset has the name
+		static const TweenPreset* FindPreset(const std::string& name);
+
+		/**
+		 * @brief Starts a preset on an entity and calls its onStart.
+		 *
+		 * @param onFinished : called after the preset's onComplete, e.g. to move a timeline to its next phase;
+		 *                     unlike the preset's callbacks it also runs for an entity destroyed meanwhile
+		 */
+		static TweenHandle Play(Entity entity, const TweenPreset& preset, const TweenParams& params,
+			TweenFinishedCallback onFinished = nullptr, std::uint32_t event = 0);
+
+		// Removes a group without calling its callbacks
+		static void Stop(TweenHandle handle);
+
+		static bool IsPlaying(TweenHandle handle);
+
+		/**
+		 * @brief Advances and applies every track, then finishes the groups whose tracks are all done.
+		 *        Groups of entities on a hidden layer are paused, as the timelines on that layer are.
+		 */
+		static void Update(float deltaTime);
+
+		/**
+		 * @brief Drops every group, e.g. before a scene change; safe to call from a callback.
+		 */
+		static void Clear();
+
+		static std::size_t GetTrackCount();
+		static std::size_t GetGroupCount() { return groups.size() - freeGroups.size(); }
+
+		// Baked value of a curve, x in [0, 1]
+		static float Sample(TweenCurve curve, float x);
+
+		static constexpr std::size_t CurveSegments = 256;
+
+	private:
+		struct TrackPool
+		{
+			std::vector<float> elapsed;         // Negative while delayed
+			std::vector<float> inverseDuration;
+			std::vector<float> from;
+			std::vector<float> delta;
+			std::vector<float> amplitude;
+			std::vector<float> waveRate;        // Wave cycles over the track
+			std::vector<float> values;
+			std::vector<std::uint8_t> ease;
+			std::vector<std::uint8_t> wave;
+			std::vector<std::uint8_t> state;    // TrackState, see TweenEngine.cpp
+			std::vector<std::uint32_t> group;
+			std::vector<Entity> entities;
+		};
+
+		struct Group
+		{
+			Entity entity = 0;
+			const TweenPreset* preset = nullptr;
+			TweenParams params;
+			TweenFinishedCallback onFinished = nullptr;
+			std::uint32_t event = 0;
+			float elapsed = 0.0f;
+			float length = 0.0f;
+			std::uint32_t pendingTracks = 0;
+			std::uint32_t generation = 1;
+			bool active = false;
+			bool hidden = false;            // On a hidden layer this update, its tracks hold still
+		};
+
+		static void BakeCurves();
+		static void SpawnTracks(std::uint32_t groupIndex);
+		static void Evaluate(TrackPool& pool, float deltaTime);
+		static void Apply(TweenProperty property, const TrackPool& pool);
+		static void RemoveTracks(const std::vector<std::uint8_t>& removed);
+		static float ReadCurrent(Entity entity, TweenProperty property);
+
+		static std::unordered_map<std::string, TweenPreset> presets;
+		static std::array<TrackPool, static_cast<std::size_t>(TweenProperty::Count)> pools;
+		static std::vector<Group> groups;
+		static std::vector<std::uint32_t> freeGroups;
+		static std::vector<std::uint8_t> removedGroups;    // Scratch for RemoveTracks, indexed by group
+		static std::array<std::array<float, CurveSegments + 1>, static_cast<std::size_t>(TweenCurve::Count)> curves;
+		static bool curvesBaked;
+		static std::uint32_t clearCount;
+	};
+}
+#endif // !_TWEEN_ENGINE_H_
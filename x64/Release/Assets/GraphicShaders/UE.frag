@@ -31,6 +31,9 @@ uniform float uAlpha;  // Value between 0.0 (fully transparent) and 1.0 (fully o
 // Use texture flag
 uniform bool useTexture;  // If true, use the texture; otherwise, use only the color
 
+// Texture colour is premultiplied by its alpha (cooked textures)
+uniform bool uPremultiplied;
+
 void main()
 {
     vec4 texColor = vec4(uColor, uAlpha);  // Default to color
@@ -38,7 +41,16 @@ void main()
     // If we're using a texture, sample the texture color
     if (useTexture)
     {
-        texColor = texture(uTexture, vTexCoord) * vec4(uColor, uAlpha);
+        vec4 texel = texture(uTexture, vTexCoord);
+        if (uPremultiplied)
+        {
+            // Keep the output premultiplied, uAlpha fades colour and coverage together
+            texColor = vec4(texel.rgb * uColor * uAlpha, texel.a * uAlpha);
+        }
+        else
+        {
+            texColor = texel * vec4(uColor, uAlpha);
+        }
     }
 
     // Final fragment color
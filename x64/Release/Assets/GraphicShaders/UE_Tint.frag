@@ -1,9 +1,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 ///
-///	@file UE_color.frag
-/// 
-/// @brief Fragment shader for handling solid colors
-///	
+///	@file UE_Tint.frag
+///
+/// @brief Fragment shader for the editor picking pass. Writes the entity ID
+///        (offset by one, 0 means nothing) as an RGB color, and discards
+///        transparent texels so picking follows the visible sprite.
+///
 ///	@Authors: Victor Lee
 ///	Copyright 2024, Digipen Institute of Technology
 ///
@@ -11,11 +13,33 @@
 
 #version 450 core
 
+// Interpolated texture coordinates from the vertex shader
+layout (location=0) in vec2 vTexCoord;
+
 uniform int entityID; // Pass the unique entity ID from your application
+
+// Texture sampler and alpha, same meaning as in UE.frag
+uniform sampler2D uTexture;
+uniform bool useTexture;
+uniform float uAlpha;
+
+// Sub-rectangle of the texture (offset.xy, size.zw), used for sprite-sheet frames
+uniform vec4 uUVRect;
+
 out vec4 FragColor;
 
 void main()
 {
+    float alpha = uAlpha;
+    if (useTexture)
+    {
+        alpha *= texture(uTexture, uUVRect.xy + vTexCoord * uUVRect.zw).a;
+    }
+    if (alpha < 0.1)
+    {
+        discard;
+    }
+
     // Encode entity ID into an RGB color
     FragColor = vec4(
         float((entityID & 0x000000FF)) / 255.0,